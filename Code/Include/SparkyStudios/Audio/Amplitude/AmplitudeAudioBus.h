@@ -16,15 +16,185 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/utils.h>
+
+#include <IAudioInterfacesCommonData.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    //! Renders a block of procedural audio directly into the mixer buffer.
+    //!
+    //! The callback is invoked from the Amplitude mixer thread, and must respect real-time constraints: no memory
+    //! allocation, no locks, no file I/O, no EBus calls, and it must return well within the duration of the block
+    //! (frameCount / sample rate). The output buffer is owned by the mixer, and holds frameCount interleaved float
+    //! frames of channelCount samples. Every sample must be written. The block may start anywhere in the stream
+    //! buffer of the voice, so the output pointer is only guaranteed to be aligned on a float: use unaligned loads
+    //! and stores when writing it with SIMD.
+    using ProceduralAudioRenderCallback = AZStd::function<void(float* output, AZ::u64 frameCount, AZ::u32 channelCount)>;
+
+    //! Spatialization quality tiers, from the cheapest to the most expensive per voice.
+    enum class PanningTier : AZ::u8
+    {
+        //! Equal-power stereo panning.
+        Stereo,
+        //! HRTF spatialization with a short impulse response.
+        BinauralLow,
+        BinauralMedium,
+        //! HRTF spatialization with the full impulse response.
+        BinauralHigh,
+    };
+
+    //! Number of real voices spatialized against a listener, keyed by the listener ATL ID.
+    using ListenerVoiceCount = AZStd::pair<AZ::u64, AZ::u32>;
+
+    //! Kinds of ATL requests counted in AudioFrameStats.
+    enum class AudioRequestType : AZ::u8
+    {
+        RegisterObject,
+        UnregisterObject,
+        ActivateTrigger,
+        StopEvent,
+        SetPosition,
+        SetEnvironment,
+        SetRtpc,
+        ResetRtpc,
+        SetSwitchState,
+        SetObstructionOcclusion,
+        SetListenerPosition,
+        RegisterBank,
+        UnregisterBank,
+        Count,
+    };
+
+    //! Statistics of the last audio update.
+    struct AudioFrameStats
+    {
+        //! Number of requests handled since the previous update, indexed by AudioRequestType.
+        AZStd::array<AZ::u32, static_cast<size_t>(AudioRequestType::Count)> m_requestCounts = {};
+        AZ::u32 m_activeEntityCount = 0;
+        AZ::u32 m_realVoiceCount = 0;
+        AZ::u32 m_virtualVoiceCount = 0;
+        //! Trigger activations accepted and suppressed by the trigger throttle since the previous update.
+        AZ::u32 m_acceptedTriggerCount = 0;
+        AZ::u32 m_suppressedTriggerCount = 0;
+        //! Bytes of soundbank data registered through the ATL since the previous update. Sound files streamed by Amplitude
+        //! itself are not counted.
+        AZ::u64 m_registeredBankBytes = 0;
+        //! Time spent in the Amplitude engine update on the audio thread, in milliseconds. The mixer renders on its own
+        //! thread, so this doesn't include the mixing time.
+        float m_engineUpdateTimeMs = 0.0f;
+        float m_averageEngineUpdateTimeMs = 0.0f;
+        float m_maxEngineUpdateTimeMs = 0.0f;
+    };
+
+    //! A spatial query on the positioned audio objects.
+    struct AudioObjectQuery
+    {
+        enum class Type : AZ::u8
+        {
+            //! Audio objects within m_radius of m_center.
+            Radius,
+            //! Audio objects within m_bounds.
+            Box,
+            //! Audio objects within the bounds of the zone m_zoneId, see SetAudioZone().
+            Zone,
+        };
+
+        Type m_type = Type::Radius;
+        AZ::Vector3 m_center = AZ::Vector3::CreateZero();
+        float m_radius = 0.0f;
+        AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        AZ::u64 m_zoneId = 0;
+    };
+
+    //! Format of a procedural audio source.
+    struct ProceduralAudioSourceConfig
+    {
+        AZ::u32 m_sampleRate = 48000;
+        AZ::u32 m_channelCount = 1;
+    };
+
     class AmplitudeAudioRequests
     {
     public:
         AZ_RTTI(AmplitudeAudioRequests, "{BA47A728-B462-4612-A2B0-CFA05117F47D}");
         virtual ~AmplitudeAudioRequests() = default;
-        // Put your public methods here
+
+        //! Registers a procedural audio source rendered by the given callback.
+        //! The returned source ID is played on an entity with an ATL source trigger, using the eACT_STREAM_PCM codec
+        //! type, on an Amplitude event playing a ".amsource" sound. The source is bound to the triggered event until
+        //! the mixer opens its voice, in a later audio frame.
+        //! @return The ID of the new source, or INVALID_AUDIO_SOURCE_ID on failure.
+        virtual ::Audio::TAudioSourceId RegisterProceduralAudioSource(
+            const ProceduralAudioSourceConfig& config, ProceduralAudioRenderCallback callback) = 0;
+
+        //! Unregisters a procedural audio source. The callback is not invoked anymore once this call returns.
+        virtual void UnregisterProceduralAudioSource(::Audio::TAudioSourceId sourceId) = 0;
+
+        //! Lets the occlusion service compute the occlusion of the given audio object from physics raycasts.
+        //! The service must be enabled in the "occlusion" settings of the runtime settings file. Occlusion
+        //! values set through the ATL on that object are ignored while it is registered.
+        virtual void SetOcclusionEmitterEnabled(::Audio::TAudioObjectID audioObjectId, bool enabled) = 0;
+
+        //! Sets the spatialization tier used when the ATL panning mode is the given one. The change is applied
+        //! immediately if that panning mode is the active one.
+        virtual void SetPanningTier(::Audio::PanningMode mode, PanningTier tier) = 0;
+
+        //! Gets the spatialization tier currently used by the mixer.
+        [[nodiscard]] virtual PanningTier GetPanningTier() const = 0;
+
+        //! Gets the number of registered audio objects in each update LOD distance band, from the nearest to the farthest.
+        [[nodiscard]] virtual AZStd::vector<AZ::u32> GetUpdateLodBandCounts() const = 0;
+
+        //! Gets the number of real voices spatialized against each listener during the last audio update. Each voice is
+        //! spatialized against its nearest listener only, so the mixing cost doesn't grow with the number of listeners.
+        [[nodiscard]] virtual AZStd::vector<ListenerVoiceCount> GetListenerVoiceCounts() const = 0;
+
+        //! Registers or moves a named box, like a reverb zone, which can be used in AudioObjectQuery::Type::Zone queries.
+        virtual void SetAudioZone(AZ::u64 zoneId, const AZ::Aabb& bounds) = 0;
+
+        //! Unregisters a zone previously registered with SetAudioZone().
+        virtual void RemoveAudioZone(AZ::u64 zoneId) = 0;
+
+        //! Finds the audio objects matching each query, from the last positions set through the ATL. The results are
+        //! returned in the same order as the queries. Only the objects around the queried areas are visited.
+        [[nodiscard]] virtual AZStd::vector<AZStd::vector<::Audio::TAudioObjectID>> QueryAudioObjects(
+            const AZStd::vector<AudioObjectQuery>& queries) const = 0;
+
+        //! Gets the request counters, voice counts and engine update timings of the last audio update. The same values are
+        //! emitted as profiler data points on each update.
+        [[nodiscard]] virtual AudioFrameStats GetAudioFrameStats() const = 0;
+
+        //! Plays a JSON timeline of triggers, positions and RTPC changes, and writes the mix to a WAV file as fast
+        //! as possible. The render runs on the audio thread at its next update, and requires the "null" driver in
+        //! the engine configuration. The audio thread is blocked until the render is done, so no other request is
+        //! handled meanwhile. The render is refused while any voice is playing, since the mix would include it. The
+        //! realtime factor of the render is logged once done.
+        virtual void RenderOffline(const AZStd::string& timelinePath, const AZStd::string& outputPath) = 0;
+
+        //! Starts recording every call made to the Amplitude implementation, with its arguments and time, into a
+        //! compact binary trace file. The capture starts at the next audio update.
+        virtual void StartRequestCapture(const AZStd::string& tracePath) = 0;
+
+        //! Stops the request capture, and closes its trace file.
+        virtual void StopRequestCapture() = 0;
+
+        //! Re-drives the Amplitude implementation from a trace recorded with StartRequestCapture(), at the original
+        //! pace multiplied by the given speed. A speed of 0 replays the trace as fast as possible on the audio thread.
+        //! The soundbanks and listeners used in the trace must already be loaded.
+        virtual void ReplayRequestCapture(const AZStd::string& tracePath, float speed) = 0;
+
+        //! Gets the number of frames rendered by the mixer per block.
+        [[nodiscard]] virtual AZ::u32 GetMixerBlockSize() const = 0;
+
+        //! Gets the output latency introduced by one mixer block, in milliseconds.
+        [[nodiscard]] virtual float GetMixerLatencyMs() const = 0;
     };
 
     class AmplitudeAudioBusTraits : public AZ::EBusTraits
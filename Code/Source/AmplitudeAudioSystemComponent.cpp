@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <AmplitudeAudioSystemComponent.h>
+#include <AmplitudeDebugOverlay.h>
 
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -83,6 +84,161 @@ namespace SparkyStudios::Audio::Amplitude
         }
     }
 
+    ::Audio::TAudioSourceId AmplitudeAudioSystemComponent::RegisterProceduralAudioSource(
+        const ProceduralAudioSourceConfig& config, ProceduralAudioRenderCallback callback)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->CreateProceduralAudioSource(config, AZStd::move(callback));
+        }
+
+        AZLOG_ERROR("[Amplitude] Unable to register a procedural audio source, the audio system is not initialized.");
+        return INVALID_AUDIO_SOURCE_ID;
+    }
+
+    void AmplitudeAudioSystemComponent::UnregisterProceduralAudioSource(::Audio::TAudioSourceId sourceId)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->DestroyProceduralAudioSource(sourceId);
+        }
+    }
+
+    void AmplitudeAudioSystemComponent::SetOcclusionEmitterEnabled(::Audio::TAudioObjectID audioObjectId, bool enabled)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->SetOcclusionEmitterEnabled(audioObjectId, enabled);
+        }
+    }
+
+    void AmplitudeAudioSystemComponent::SetPanningTier(::Audio::PanningMode mode, PanningTier tier)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->SetPanningTier(mode, tier);
+        }
+    }
+
+    PanningTier AmplitudeAudioSystemComponent::GetPanningTier() const
+    {
+        if (const auto* amplitudeEngine = azrtti_cast<const ::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->GetPanningTier();
+        }
+
+        return PanningTier::Stereo;
+    }
+
+    AZStd::vector<AZ::u32> AmplitudeAudioSystemComponent::GetUpdateLodBandCounts() const
+    {
+        if (const auto* amplitudeEngine = azrtti_cast<const ::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->GetUpdateLodBandCounts();
+        }
+
+        return {};
+    }
+
+    AZStd::vector<ListenerVoiceCount> AmplitudeAudioSystemComponent::GetListenerVoiceCounts() const
+    {
+        if (const auto* amplitudeEngine = azrtti_cast<const ::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->GetListenerVoiceCounts();
+        }
+
+        return {};
+    }
+
+    AudioFrameStats AmplitudeAudioSystemComponent::GetAudioFrameStats() const
+    {
+        if (const auto* amplitudeEngine = azrtti_cast<const ::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->GetAudioFrameStats();
+        }
+
+        return {};
+    }
+
+    void AmplitudeAudioSystemComponent::RenderOffline(const AZStd::string& timelinePath, const AZStd::string& outputPath)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->RequestOfflineRender(timelinePath, outputPath);
+        }
+    }
+
+    void AmplitudeAudioSystemComponent::StartRequestCapture(const AZStd::string& tracePath)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->StartRequestCapture(tracePath);
+        }
+    }
+
+    void AmplitudeAudioSystemComponent::StopRequestCapture()
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->StopRequestCapture();
+        }
+    }
+
+    void AmplitudeAudioSystemComponent::ReplayRequestCapture(const AZStd::string& tracePath, const float speed)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->ReplayRequestCapture(tracePath, speed);
+        }
+    }
+
+    void AmplitudeAudioSystemComponent::SetAudioZone(const AZ::u64 zoneId, const AZ::Aabb& bounds)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->SetAudioZone(zoneId, bounds);
+        }
+    }
+
+    void AmplitudeAudioSystemComponent::RemoveAudioZone(const AZ::u64 zoneId)
+    {
+        if (auto* amplitudeEngine = azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            amplitudeEngine->RemoveAudioZone(zoneId);
+        }
+    }
+
+    AZStd::vector<AZStd::vector<::Audio::TAudioObjectID>> AmplitudeAudioSystemComponent::QueryAudioObjects(
+        const AZStd::vector<AudioObjectQuery>& queries) const
+    {
+        if (const auto* amplitudeEngine = azrtti_cast<const ::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->QueryAudioObjects(queries);
+        }
+
+        return AZStd::vector<AZStd::vector<::Audio::TAudioObjectID>>(queries.size());
+    }
+
+    AZ::u32 AmplitudeAudioSystemComponent::GetMixerBlockSize() const
+    {
+        if (const auto* amplitudeEngine = azrtti_cast<const ::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->GetMixerBlockSize();
+        }
+
+        return 0;
+    }
+
+    float AmplitudeAudioSystemComponent::GetMixerLatencyMs() const
+    {
+        if (const auto* amplitudeEngine = azrtti_cast<const ::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get()))
+        {
+            return amplitudeEngine->GetMixerLatencyMs();
+        }
+
+        return 0.0f;
+    }
+
     bool AmplitudeAudioSystemComponent::Initialize()
     {
         bool result = false;
@@ -131,6 +287,11 @@ namespace SparkyStudios::Audio::Amplitude
             ::Audio::SystemRequest::Initialize initAudio;
             AZ::Interface<::Audio::IAudioSystem>::Get()->PushRequestBlocking(AZStd::move(initAudio));
 
+#if !defined(AMPLITUDE_RELEASE) && defined(IMGUI_ENABLED)
+            _debugOverlay = AZStd::make_unique<AmplitudeDebugOverlay>(
+                azrtti_cast<::Audio::AmplitudeAudioSystem*>(_amplitudeEngine.get())->GetDebugSnapshots());
+#endif // !AMPLITUDE_RELEASE && IMGUI_ENABLED
+
             result = true;
         }
         else
@@ -143,6 +304,10 @@ namespace SparkyStudios::Audio::Amplitude
 
     void AmplitudeAudioSystemComponent::Release()
     {
+#if !defined(AMPLITUDE_RELEASE) && defined(IMGUI_ENABLED)
+        _debugOverlay.reset();
+#endif // !AMPLITUDE_RELEASE && IMGUI_ENABLED
+
         _amplitudeEngine.reset();
 
         if (AZ::AllocatorInstance<::Audio::AudioImplAllocator>::IsReady())
@@ -26,6 +26,8 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    class AmplitudeDebugOverlay;
+
     class AmplitudeAudioSystemComponent
         : public AZ::Component
         , public AZ::TickBus::Handler
@@ -47,7 +49,25 @@ namespace SparkyStudios::Audio::Amplitude
 
     protected:
         // AmplitudeAudioRequestBus interface implementation
-
+        ::Audio::TAudioSourceId RegisterProceduralAudioSource(
+            const ProceduralAudioSourceConfig& config, ProceduralAudioRenderCallback callback) override;
+        void UnregisterProceduralAudioSource(::Audio::TAudioSourceId sourceId) override;
+        void SetOcclusionEmitterEnabled(::Audio::TAudioObjectID audioObjectId, bool enabled) override;
+        void SetPanningTier(::Audio::PanningMode mode, PanningTier tier) override;
+        [[nodiscard]] PanningTier GetPanningTier() const override;
+        [[nodiscard]] AZStd::vector<AZ::u32> GetUpdateLodBandCounts() const override;
+        [[nodiscard]] AZStd::vector<ListenerVoiceCount> GetListenerVoiceCounts() const override;
+        [[nodiscard]] AudioFrameStats GetAudioFrameStats() const override;
+        void RenderOffline(const AZStd::string& timelinePath, const AZStd::string& outputPath) override;
+        void StartRequestCapture(const AZStd::string& tracePath) override;
+        void StopRequestCapture() override;
+        void ReplayRequestCapture(const AZStd::string& tracePath, float speed) override;
+        void SetAudioZone(AZ::u64 zoneId, const AZ::Aabb& bounds) override;
+        void RemoveAudioZone(AZ::u64 zoneId) override;
+        [[nodiscard]] AZStd::vector<AZStd::vector<::Audio::TAudioObjectID>> QueryAudioObjects(
+            const AZStd::vector<AudioObjectQuery>& queries) const override;
+        [[nodiscard]] AZ::u32 GetMixerBlockSize() const override;
+        [[nodiscard]] float GetMixerLatencyMs() const override;
 
         // Audio::Gem::AudioEngineGemRequestBus interface implementation
         bool Initialize() override;
@@ -63,5 +83,9 @@ namespace SparkyStudios::Audio::Amplitude
 
     private:
         AZStd::unique_ptr<::Audio::AudioSystemImplementation> _amplitudeEngine;
+
+#if !defined(AMPLITUDE_RELEASE) && defined(IMGUI_ENABLED)
+        AZStd::unique_ptr<AmplitudeDebugOverlay> _debugOverlay;
+#endif // !AMPLITUDE_RELEASE && IMGUI_ENABLED
     };
 } // namespace SparkyStudios::Audio::Amplitude
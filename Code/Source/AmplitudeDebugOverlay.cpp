@@ -0,0 +1,166 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/IConsole.h>
+
+#if !defined(AMPLITUDE_RELEASE)
+AZ_CVAR(
+    bool,
+    amp_debugOverlay,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "Shows the Amplitude audio debug overlay. Only available when the ImGui gem is enabled in the project.");
+#endif // !AMPLITUDE_RELEASE
+
+#if !defined(AMPLITUDE_RELEASE) && defined(IMGUI_ENABLED)
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/string/string.h>
+
+#include <imgui/imgui.h>
+
+#include <AmplitudeDebugOverlay.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    static constexpr const char* kRequestTypeLabels[] = {
+        "Register object",
+        "Unregister object",
+        "Activate trigger",
+        "Stop event",
+        "Set position",
+        "Set environment",
+        "Set RTPC",
+        "Reset RTPC",
+        "Set switch state",
+        "Set obstruction/occlusion",
+        "Set listener position",
+        "Register bank",
+        "Unregister bank",
+    };
+
+    static_assert(
+        AZ_ARRAY_SIZE(kRequestTypeLabels) == static_cast<size_t>(AudioRequestType::Count), "A label is required for each request type.");
+
+    AmplitudeDebugOverlay::AmplitudeDebugOverlay(::Audio::AmplitudeDebugSnapshotBuffer* const snapshots)
+        : _snapshots(snapshots)
+    {
+        ImGui::ImGuiUpdateListenerBus::Handler::BusConnect();
+    }
+
+    AmplitudeDebugOverlay::~AmplitudeDebugOverlay()
+    {
+        ImGui::ImGuiUpdateListenerBus::Handler::BusDisconnect();
+    }
+
+    void AmplitudeDebugOverlay::OnImGuiUpdate()
+    {
+        if (!amp_debugOverlay)
+        {
+            return;
+        }
+
+        bool isOpen = true;
+
+        if (ImGui::Begin("Amplitude Audio", &isOpen))
+        {
+            if (const ::Audio::SAmplitudeDebugSnapshot* snapshot = _snapshots->AcquireLatest())
+            {
+                DrawSnapshot(*snapshot);
+            }
+            else
+            {
+                ImGui::TextUnformatted("Waiting for the audio thread...");
+            }
+        }
+
+        ImGui::End();
+
+        if (!isOpen)
+        {
+            amp_debugOverlay = false;
+        }
+    }
+
+    void AmplitudeDebugOverlay::DrawSnapshot(const ::Audio::SAmplitudeDebugSnapshot& snapshot) const
+    {
+        const AudioFrameStats& stats = snapshot.sFrameStats;
+
+        // Time spent in the engine update against the time available to the audio update. Mixing runs on its own thread.
+        const float load = snapshot.fBudgetMs > 0.0f ? stats.m_engineUpdateTimeMs / snapshot.fBudgetMs : 0.0f;
+        const AZStd::string loadLabel = AZStd::string::format(
+            "%.2f / %.2f ms (avg %.2f, max %.2f)", stats.m_engineUpdateTimeMs, snapshot.fBudgetMs,
+            stats.m_averageEngineUpdateTimeMs, stats.m_maxEngineUpdateTimeMs);
+
+        ImGui::TextUnformatted("Engine update load");
+        ImGui::ProgressBar(AZStd::min(load, 1.0f), ImVec2(-1.0f, 0.0f), loadLabel.c_str());
+
+        ImGui::Text(
+            "Voices: %u real, %u virtual - Entities: %u", stats.m_realVoiceCount, stats.m_virtualVoiceCount, stats.m_activeEntityCount);
+        ImGui::Text("Triggers: %u accepted, %u suppressed", stats.m_acceptedTriggerCount, stats.m_suppressedTriggerCount);
+
+        if (ImGui::CollapsingHeader("Listeners", ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            for (const auto& [listenerId, voiceCount] : snapshot.cListenerVoiceCounts)
+            {
+                ImGui::Text("Listener %llu: %u voices", static_cast<unsigned long long>(listenerId), voiceCount);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Top events", ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            for (const auto& [eventId, voiceCount] : snapshot.cTopEvents)
+            {
+                ImGui::Text("Event %llu: %u voices", static_cast<unsigned long long>(eventId), voiceCount);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Environment buses"))
+        {
+            for (const auto& [busId, gain] : snapshot.cBusGains)
+            {
+                const AZStd::string label = AZStd::string::format("Bus %llu: %.2f", static_cast<unsigned long long>(busId), gain);
+                ImGui::ProgressBar(AZStd::min(gain, 1.0f), ImVec2(-1.0f, 0.0f), label.c_str());
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Requests"))
+        {
+            for (size_t i = 0; i < stats.m_requestCounts.size(); ++i)
+            {
+                ImGui::Text("%s: %u", kRequestTypeLabels[i], stats.m_requestCounts[i]);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Banks"))
+        {
+            for (const auto& bank : snapshot.cResidentBanks)
+            {
+                ImGui::Text("%s - %.1f KiB%s", bank.sFileName.c_str(), bank.nSize / 1024.0f, bank.bLocalized ? " (localized)" : "");
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Memory"))
+        {
+            for (const auto& pool : snapshot.cMemoryPools)
+            {
+                ImGui::Text(
+                    "%s: %.1f KiB - %u allocs, %u frees", pool.m_poolName, pool.m_memoryUsed / 1024.0f, pool.m_numAllocs, pool.m_numFrees);
+            }
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // !AMPLITUDE_RELEASE && IMGUI_ENABLED
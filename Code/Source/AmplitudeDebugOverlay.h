@@ -0,0 +1,43 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#if !defined(AMPLITUDE_RELEASE) && defined(IMGUI_ENABLED)
+
+#include <ImGuiBus.h>
+
+#include <Engine/AmplitudeDebugSnapshot.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    //! ImGui overlay showing the state of the Amplitude audio system, toggled with the amp_debugOverlay CVar.
+    //! The overlay only reads the snapshots published by the audio thread, and never blocks it.
+    class AmplitudeDebugOverlay : public ImGui::ImGuiUpdateListenerBus::Handler
+    {
+    public:
+        explicit AmplitudeDebugOverlay(::Audio::AmplitudeDebugSnapshotBuffer* snapshots);
+        ~AmplitudeDebugOverlay() override;
+
+        // ImGui::ImGuiUpdateListenerBus
+        void OnImGuiUpdate() override;
+
+    private:
+        void DrawSnapshot(const ::Audio::SAmplitudeDebugSnapshot& snapshot) const;
+
+        ::Audio::AmplitudeDebugSnapshotBuffer* _snapshots;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // !AMPLITUDE_RELEASE && IMGUI_ENABLED
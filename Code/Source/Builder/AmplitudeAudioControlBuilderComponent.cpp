@@ -39,7 +39,7 @@ namespace SparkyStudios::Audio::Amplitude
         builderDescriptor.m_patterns.push_back(AssetBuilderSDK::AssetBuilderPattern(
             R"((.*libs\/gameaudio\/Amplitude\/).*\.xml)", AssetBuilderSDK::AssetBuilderPattern::PatternType::Regex));
         builderDescriptor.m_busId = azrtti_typeid<AmplitudeAudioControlBuilderWorker>();
-        builderDescriptor.m_version = 2;
+        builderDescriptor.m_version = 5;
         builderDescriptor.m_createJobFunction = [ObjectPtr = &m_audioControlBuilder](auto&& PH1, auto&& PH2)
         {
             ObjectPtr->CreateJobs(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2));
@@ -49,9 +49,6 @@ namespace SparkyStudios::Audio::Amplitude
             ObjectPtr->ProcessJob(std::forward<decltype(PH1)>(PH1), std::forward<decltype(PH2)>(PH2));
         };
 
-        // (optimization) this builder does not emit source dependencies:
-        builderDescriptor.m_flags |= AssetBuilderSDK::AssetBuilderDesc::BF_EmitsNoDependencies;
-
         m_audioControlBuilder.BusConnect(builderDescriptor.m_busId);
 
         AssetBuilderSDK::AssetBuilderBus::Broadcast(
@@ -15,6 +15,7 @@
 #include <Config.h>
 
 #include <Builder/AmplitudeAudioControlBuilderWorker.h>
+#include <Engine/AmplitudeControlCache.h>
 #include <Engine/Common.h>
 
 #include <ATLCommon.h>
@@ -25,6 +26,7 @@
 #include <AzCore/JSON/rapidjson.h>
 #include <AzCore/PlatformId/PlatformId.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 
 #include <AzFramework/IO/LocalFileIO.h>
 
@@ -34,6 +36,10 @@ namespace SparkyStudios::Audio::Amplitude
     {
         const char JsonEventsKey[] = "events";
 
+        // The control file itself is the product 0 of the job.
+        const AZ::u32 ControlCacheProductSubId = 1;
+        const AZ::Uuid ControlCacheAssetType("{951E0DF5-203B-4903-A1DF-8D7F12B9334A}");
+
         const char NodeDoesNotExistMessage[] =
             "%s node does not exist. Please be sure that you have defined at least one %s for this Audio Control file.\n";
         const char MalformedNodeMissingAttributeMessage[] = "%s node is malformed: does not have an attribute %s defined. This is likely "
@@ -213,6 +219,37 @@ namespace SparkyStudios::Audio::Amplitude
             return AZ::Success();
         }
 
+        AZStd::string GetBankSourcePath(const AZStd::string& projectSourcePath, const AZStd::string& relativeBankPath)
+        {
+            // Create the full path to the source file from the bank file.
+            AZStd::string bankMetadataPath;
+            AZ::StringFunc::Path::Join(projectSourcePath.c_str(), relativeBankPath.c_str(), bankMetadataPath);
+            AZ::StringFunc::Path::ReplaceExtension(bankMetadataPath, kProjectFileExtension);
+
+            return bankMetadataPath;
+        }
+
+        bool ReadControlFile(const AZStd::string& path, AZStd::vector<char>& buffer, AZ::rapidxml::xml_document<char>& xmlDoc)
+        {
+            AZ::IO::FileIOStream fileStream;
+            if (!fileStream.Open(path.c_str(), AZ::IO::OpenMode::ModeRead))
+            {
+                return false;
+            }
+
+            const AZ::IO::SizeType length = fileStream.GetLength();
+            if (length == 0)
+            {
+                return false;
+            }
+
+            buffer.resize_no_construct(length + 1);
+            fileStream.Read(length, buffer.data());
+            buffer.back() = 0;
+
+            return xmlDoc.parse<AZ::rapidxml::parse_no_data_nodes>(buffer.data());
+        }
+
         AZ::Outcome<void, AZStd::string> GetEventsFromBank(const AZStd::string& bankMetadataPath, AZStd::set<AZStd::string>& eventNames)
         {
             if (!AZ::IO::SystemFile::Exists(bankMetadataPath.c_str()))
@@ -272,6 +309,20 @@ namespace SparkyStudios::Audio::Amplitude
             return;
         }
 
+        // The events of the controls are validated against the soundbank source files they reference. Declaring them as
+        // source dependencies reprocesses the controls when one of those banks changes, and only these controls. This
+        // requires the Asset Processor to track these files: AssetProcessorGemConfig.setreg excludes the Amplitude
+        // project, but not its .json files.
+        AZStd::string fullPath;
+        AZ::StringFunc::Path::Join(request.m_watchFolder.c_str(), request.m_sourceFile.c_str(), fullPath);
+
+        for (const AZStd::string& bankMetadataPath : GetReferencedBankSourcePaths(fullPath))
+        {
+            AssetBuilderSDK::SourceFileDependency sourceFileDependency;
+            sourceFileDependency.m_sourceFileDependencyPath = bankMetadataPath;
+            response.m_sourceFileDependencyList.push_back(sourceFileDependency);
+        }
+
         for (const AssetBuilderSDK::PlatformInfo& info : request.m_enabledPlatforms)
         {
             if (info.m_identifier == "server")
@@ -316,6 +367,15 @@ namespace SparkyStudios::Audio::Amplitude
         }
 
         response.m_outputProducts.push_back(jobProduct);
+
+        // The runtime parses the XML when the cache is missing, so a failure here doesn't fail the job.
+        if (!BuildControlCache(request, response))
+        {
+            AZ_Warning(
+                "Amplitude Audio Control Builder", false, "Failed to build the control cache of %s, it will be parsed at load time.",
+                fileName.c_str());
+        }
+
         response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
     }
 
@@ -324,43 +384,151 @@ namespace SparkyStudios::Audio::Amplitude
         AZStd::vector<AssetBuilderSDK::ProductDependency>& productDependencies,
         AssetBuilderSDK::ProductPathDependencySet& pathDependencies)
     {
-        AZ::IO::FileIOStream fileStream;
-        if (!fileStream.Open(request.m_fullPath.c_str(), AZ::IO::OpenMode::ModeRead))
+        AZStd::vector<char> charBuffer;
+        AZ::rapidxml::xml_document<char> xmlDoc;
+        if (!Internal::ReadControlFile(request.m_fullPath, charBuffer, xmlDoc))
         {
             return false;
         }
 
-        const AZ::IO::SizeType length = fileStream.GetLength();
-        if (length == 0)
+        // Get the XML root node
+        const AZ::rapidxml::xml_node<char>* xmlRootNode = xmlDoc.first_node();
+        if (!xmlRootNode)
         {
             return false;
         }
 
-        AZStd::vector<char> charBuffer;
-        charBuffer.resize_no_construct(length + 1);
-        fileStream.Read(length, charBuffer.data());
-        charBuffer.back() = 0;
+        ParseProductDependenciesFromXmlFile(
+            xmlRootNode, request.m_fullPath, request.m_sourceFile, request.m_platformInfo.m_identifier, productDependencies,
+            pathDependencies);
 
-        // Get the XML root node
+        return true;
+    }
+
+    bool AmplitudeAudioControlBuilderWorker::BuildControlCache(
+        const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+    {
+        AZStd::vector<char> charBuffer;
         AZ::rapidxml::xml_document<char> xmlDoc;
-        if (!xmlDoc.parse<AZ::rapidxml::parse_no_data_nodes>(charBuffer.data()))
+        if (!Internal::ReadControlFile(request.m_fullPath, charBuffer, xmlDoc) || xmlDoc.first_node() == nullptr)
         {
             return false;
         }
 
-        const AZ::rapidxml::xml_node<char>* xmlRootNode = xmlDoc.first_node();
-        if (!xmlRootNode)
+        AZStd::vector<AZ::u8> cacheData;
+        if (!::Audio::AmplitudeControlCache::Build(xmlDoc.first_node(), cacheData))
+        {
+            // No Amplitude connection in this control file, nothing to cache.
+            return true;
+        }
+
+        AZStd::string cacheFileName;
+        AZ::StringFunc::Path::GetFileName(request.m_fullPath.c_str(), cacheFileName);
+        cacheFileName += kControlCacheFileExtension;
+
+        AZStd::string cachePath;
+        AZ::StringFunc::Path::Join(request.m_tempDirPath.c_str(), cacheFileName.c_str(), cachePath);
+
+        AZ::IO::FileIOStream fileStream;
+        if (!fileStream.Open(cachePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary) ||
+            fileStream.Write(cacheData.size(), cacheData.data()) != cacheData.size())
         {
             return false;
         }
 
-        ParseProductDependenciesFromXmlFile(
-            xmlRootNode, request.m_fullPath, request.m_sourceFile, request.m_platformInfo.m_identifier, productDependencies,
-            pathDependencies);
+        fileStream.Close();
 
+        response.m_outputProducts.emplace_back(cacheFileName, Internal::ControlCacheAssetType, Internal::ControlCacheProductSubId);
         return true;
     }
 
+    AZStd::vector<AZStd::string> AmplitudeAudioControlBuilderWorker::GetReferencedBankSourcePaths(const AZStd::string& fullPath) const
+    {
+        AZStd::vector<AZStd::string> bankSourcePaths;
+
+        AZStd::vector<char> charBuffer;
+        AZ::rapidxml::xml_document<char> xmlDoc;
+        if (!Internal::ReadControlFile(fullPath, charBuffer, xmlDoc) || xmlDoc.first_node() == nullptr)
+        {
+            return bankSourcePaths;
+        }
+
+        const auto preloadsNode = xmlDoc.first_node()->first_node(::Audio::ATLXmlTags::PreloadsNodeTag);
+        if (!preloadsNode)
+        {
+            return bankSourcePaths;
+        }
+
+        // Malformed preloads are reported by the job, the banks gathered before the error are still dependencies.
+        AZStd::vector<AZStd::string> banksReferenced;
+        [[maybe_unused]] const auto gatherBankReferencesResult = Internal::GetBanksFromAtlPreloads(preloadsNode, banksReferenced);
+
+        const AZStd::string projectSourcePath = GetProjectSourcePath(fullPath);
+        if (projectSourcePath.empty())
+        {
+            return bankSourcePaths;
+        }
+
+        for (const AZStd::string& relativeBankPath : banksReferenced)
+        {
+            bankSourcePaths.push_back(Internal::GetBankSourcePath(projectSourcePath, relativeBankPath));
+        }
+
+        return bankSourcePaths;
+    }
+
+    AZStd::string AmplitudeAudioControlBuilderWorker::GetProjectSourcePath(const AZStd::string& fullPath) const
+    {
+        AZStd::string projectSourcePath(fullPath);
+
+        const size_t assetsDirIndex = projectSourcePath.find(AMPLITUDE_ASSETS_DIR_NAME);
+        if (assetsDirIndex == AZStd::string::npos)
+        {
+            return {};
+        }
+
+        projectSourcePath.replace(assetsDirIndex, strlen(AMPLITUDE_ASSETS_DIR_NAME), AMPLITUDE_PROJECT_DIR_NAME);
+
+        AZ::u64 firstSubDirectoryIndex = AZ::StringFunc::Find(projectSourcePath, m_globalScopeControlsPath);
+        AZ::StringFunc::LKeep(projectSourcePath, firstSubDirectoryIndex);
+
+        return projectSourcePath;
+    }
+
+    AZ::Outcome<void, AZStd::string> AmplitudeAudioControlBuilderWorker::GetEventsFromBank(
+        const AZStd::string& bankMetadataPath, AZStd::set<AZStd::string>& eventNames)
+    {
+        // Jobs run in parallel, and the same banks are referenced by many control files.
+        const AZ::u64 modificationTime = AZ::IO::SystemFile::ModificationTime(bankMetadataPath.c_str());
+        const AZ::u64 fileSize = AZ::IO::SystemFile::Length(bankMetadataPath.c_str());
+
+        {
+            AZStd::scoped_lock lock(m_bankEventsCacheMutex);
+
+            if (const auto it = m_bankEventsCache.find(bankMetadataPath); it != m_bankEventsCache.end() &&
+                it->second.m_modificationTime == modificationTime && it->second.m_fileSize == fileSize)
+            {
+                eventNames.insert(it->second.m_eventNames.begin(), it->second.m_eventNames.end());
+                return AZ::Success();
+            }
+        }
+
+        // Failures are not cached, so that a fixed bank is parsed again by the next job.
+        AZStd::set<AZStd::string> bankEventNames;
+        AZ::Outcome<void, AZStd::string> result = Internal::GetEventsFromBank(bankMetadataPath, bankEventNames);
+        if (!result.IsSuccess())
+        {
+            return result;
+        }
+
+        eventNames.insert(bankEventNames.begin(), bankEventNames.end());
+
+        AZStd::scoped_lock lock(m_bankEventsCacheMutex);
+        m_bankEventsCache[bankMetadataPath] = BankEvents{ modificationTime, fileSize, AZStd::move(bankEventNames) };
+
+        return AZ::Success();
+    }
+
     void AmplitudeAudioControlBuilderWorker::ParseProductDependenciesFromXmlFile(
         const AZ::rapidxml::xml_node<char>* node,
         const AZStd::string& fullPath,
@@ -426,25 +594,25 @@ namespace SparkyStudios::Audio::Amplitude
             return;
         }
 
-        AZStd::string fp = AZStd::string(fullPath.c_str());
-        AZStd::string projectSourcePath =
-            fp.replace(fp.find(AMPLITUDE_ASSETS_DIR_NAME), strlen(AMPLITUDE_ASSETS_DIR_NAME), AMPLITUDE_PROJECT_DIR_NAME);
+        const AZStd::string projectSourcePath = GetProjectSourcePath(fullPath);
+        if (projectSourcePath.empty())
+        {
+            AZ_Warning(
+                "Amplitude Audio Control Builder", false, "Unable to locate the Amplitude project of Audio Control file %s.",
+                sourceFile.c_str());
+            return;
+        }
+
         AZ_TracePrintf(AssetBuilderSDK::InfoWindow, projectSourcePath.c_str());
-        AZ::u64 firstSubDirectoryIndex = AZ::StringFunc::Find(projectSourcePath, m_globalScopeControlsPath);
-        AZ::StringFunc::LKeep(projectSourcePath, firstSubDirectoryIndex);
 
         AZStd::set<AZStd::string> amEventsInReferencedBanks;
 
         // Load all source files for all banks referenced and aggregate the list of events in those files.
         for (const AZStd::string& relativeBankPath : banksReferenced)
         {
-            // Create the full path to the source file from the bank file.
-            AZStd::string bankMetadataPath;
-            AZ::StringFunc::Path::Join(projectSourcePath.c_str(), relativeBankPath.c_str(), bankMetadataPath);
-            AZ::StringFunc::Path::ReplaceExtension(bankMetadataPath, kProjectFileExtension);
+            const AZStd::string bankMetadataPath = Internal::GetBankSourcePath(projectSourcePath, relativeBankPath);
 
-            AZ::Outcome<void, AZStd::string> getReferencedEventsResult =
-                Internal::GetEventsFromBank(bankMetadataPath, amEventsInReferencedBanks);
+            AZ::Outcome<void, AZStd::string> getReferencedEventsResult = GetEventsFromBank(bankMetadataPath, amEventsInReferencedBanks);
             if (!getReferencedEventsResult.IsSuccess())
             {
                 // only warn if we couldn't get info from a bankdeps file. Won't impact registering dependencies, but used to help
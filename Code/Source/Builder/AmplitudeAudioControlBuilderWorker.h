@@ -16,8 +16,14 @@
 
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/Outcome/Outcome.h>
 #include <AzCore/XML/rapidxml.h>
+#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
@@ -44,6 +50,9 @@ namespace SparkyStudios::Audio::Amplitude
             AssetBuilderSDK::ProductPathDependencySet& pathDependencies);
 
     private:
+        //! Writes the binary cache of the Amplitude connections of the control file, as a second product of the job.
+        bool BuildControlCache(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response);
+
         void ParseProductDependenciesFromXmlFile(
             const AZ::rapidxml::xml_node<char>* node,
             const AZStd::string& fullPath,
@@ -52,7 +61,26 @@ namespace SparkyStudios::Audio::Amplitude
             AZStd::vector<AssetBuilderSDK::ProductDependency>& productDependencies,
             AssetBuilderSDK::ProductPathDependencySet& pathDependencies);
 
+        //! Gets the full paths of the soundbank source files referenced by the preloads of a control file.
+        AZStd::vector<AZStd::string> GetReferencedBankSourcePaths(const AZStd::string& fullPath) const;
+
+        //! Gets the folder of the Amplitude project matching a control file, or an empty string if it can't be found.
+        AZStd::string GetProjectSourcePath(const AZStd::string& fullPath) const;
+
+        //! Adds the events of a soundbank source file to the set. The events of each bank are parsed once, and
+        //! parsed again only when the bank file is modified.
+        AZ::Outcome<void, AZStd::string> GetEventsFromBank(const AZStd::string& bankMetadataPath, AZStd::set<AZStd::string>& eventNames);
+
+        struct BankEvents
+        {
+            AZ::u64 m_modificationTime;
+            AZ::u64 m_fileSize;
+            AZStd::set<AZStd::string> m_eventNames;
+        };
+
         AZStd::string m_globalScopeControlsPath;
+        AZStd::unordered_map<AZStd::string, BankEvents> m_bankEventsCache;
+        AZStd::mutex m_bankEventsCacheMutex;
         AZStd::atomic_bool m_isShuttingDown;
     };
 } // namespace SparkyStudios::Audio::Amplitude
@@ -25,6 +25,9 @@ namespace SparkyStudios::Audio::Amplitude
 
     static constexpr char kEngineConfigFile[] = "audio_config.json";
     static constexpr char kBusesConfigFile[] = "buses.json";
+    // Settings of the gem which are not part of the Amplitude engine config. It is authored in the project folder and
+    // copied to the assets folder by the project compiler, so it ships with the cached assets.
+    static constexpr char kRuntimeSettingsFile[] = "runtime_settings.json";
     static constexpr char kInitBankFile[] = "init.ambank";
 
     static constexpr char kProjectFileExtension[] = ".json";
@@ -39,6 +42,10 @@ namespace SparkyStudios::Audio::Amplitude
     static constexpr char kAssetSwitchContainerFileExtension[] = ".amswitchcontainer";
     static constexpr char kAssetRtpcFileExtension[] = ".amrtpc";
     static constexpr char kAssetMediaFileExtension[] = ".ams";
+    static constexpr char kAssetAudioInputSourceFileExtension[] = ".amsource";
+
+    // Binary cache emitted by the control builder next to each audio control file.
+    static constexpr char kControlCacheFileExtension[] = ".amctrlcache";
 
     // Project Folders
     static constexpr char kEventsFolder[] = "events";
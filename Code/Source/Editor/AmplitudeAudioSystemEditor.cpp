@@ -221,6 +221,11 @@ namespace SparkyStudios::Audio::Amplitude
                 }
             }
 
+            if (middlewareControl->GetType() == eAMCT_AMPLITUDE_EVENT)
+            {
+                return AZStd::make_shared<CEventConnection>(middlewareControl->GetId());
+            }
+
             return AZStd::make_shared<IAudioConnection>(middlewareControl->GetId());
         }
 
@@ -332,6 +337,33 @@ namespace SparkyStudios::Audio::Amplitude
                             }
                         }
                     }
+                    else if (type == eAMCT_AMPLITUDE_EVENT)
+                    {
+                        TEventConnectionPtr connection = AZStd::make_shared<CEventConnection>(control->GetId());
+
+                        if (auto priorityAttr = node->first_attribute(XmlTags::kPriorityAttribute, 0, false); priorityAttr != nullptr)
+                        {
+                            AZ::StringFunc::LooksLikeFloat(priorityAttr->value(), &connection->m_priority);
+                        }
+
+                        if (auto durationAttr = node->first_attribute(XmlTags::kDurationAttribute, 0, false); durationAttr != nullptr)
+                        {
+                            AZ::StringFunc::LooksLikeFloat(durationAttr->value(), &connection->m_duration);
+                        }
+
+                        if (auto windowAttr = node->first_attribute(XmlTags::kCoalescingWindowAttribute, 0, false); windowAttr != nullptr)
+                        {
+                            AZ::StringFunc::LooksLikeFloat(windowAttr->value(), &connection->m_coalescingWindow);
+                        }
+
+                        if (auto maxInstancesAttr = node->first_attribute(XmlTags::kMaxInstancesAttribute, 0, false);
+                            maxInstancesAttr != nullptr)
+                        {
+                            AZ::StringFunc::LooksLikeInt(maxInstancesAttr->value(), &connection->m_maxInstances);
+                        }
+
+                        return connection;
+                    }
                     else
                     {
                         return AZStd::make_shared<IAudioConnection>(control->GetId());
@@ -443,7 +475,61 @@ namespace SparkyStudios::Audio::Amplitude
                 }
 
             case AudioControls::eAMCT_AMPLITUDE_EVENT:
-                [[fallthrough]];
+                {
+                    auto connectionNode = xmlAllocator.allocate_node(
+                        AZ::rapidxml::node_element, xmlAllocator.allocate_string(TypeToTag(control->GetType()).data()));
+
+                    auto idAttr = xmlAllocator.allocate_attribute(
+                        XmlTags::kIdAttribute, xmlAllocator.allocate_string(AZStd::to_string(control->GetAmplitudeId()).c_str()));
+
+                    auto nameAttr =
+                        xmlAllocator.allocate_attribute(XmlTags::kNameAttribute, xmlAllocator.allocate_string(control->GetName().c_str()));
+
+                    connectionNode->append_attribute(idAttr);
+                    connectionNode->append_attribute(nameAttr);
+
+                    AZStd::shared_ptr<const CEventConnection> eventConnection =
+                        AZStd::static_pointer_cast<const CEventConnection>(connection);
+
+                    if (eventConnection->m_priority != 1.f)
+                    {
+                        auto priorityAttr = xmlAllocator.allocate_attribute(
+                            XmlTags::kPriorityAttribute,
+                            xmlAllocator.allocate_string(AZStd::to_string(eventConnection->m_priority).c_str()));
+
+                        connectionNode->append_attribute(priorityAttr);
+                    }
+
+                    if (eventConnection->m_duration != 0.f)
+                    {
+                        auto durationAttr = xmlAllocator.allocate_attribute(
+                            XmlTags::kDurationAttribute,
+                            xmlAllocator.allocate_string(AZStd::to_string(eventConnection->m_duration).c_str()));
+
+                        connectionNode->append_attribute(durationAttr);
+                    }
+
+                    if (eventConnection->m_coalescingWindow != 0.f)
+                    {
+                        auto windowAttr = xmlAllocator.allocate_attribute(
+                            XmlTags::kCoalescingWindowAttribute,
+                            xmlAllocator.allocate_string(AZStd::to_string(eventConnection->m_coalescingWindow).c_str()));
+
+                        connectionNode->append_attribute(windowAttr);
+                    }
+
+                    if (eventConnection->m_maxInstances != 1)
+                    {
+                        auto maxInstancesAttr = xmlAllocator.allocate_attribute(
+                            XmlTags::kMaxInstancesAttribute,
+                            xmlAllocator.allocate_string(AZStd::to_string(eventConnection->m_maxInstances).c_str()));
+
+                        connectionNode->append_attribute(maxInstancesAttr);
+                    }
+
+                    return connectionNode;
+                }
+
             case AudioControls::eAMCT_AMPLITUDE_BUS:
                 {
                     auto connectionNode = xmlAllocator.allocate_node(
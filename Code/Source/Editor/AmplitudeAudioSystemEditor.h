@@ -93,6 +93,35 @@ namespace SparkyStudios::Audio::Amplitude
 
     using TEffectConnectionPtr = AZStd::shared_ptr<CEffectConnection>;
 
+    //-------------------------------------------------------------------------------------------//
+    class CEventConnection : public IAudioConnection
+    {
+    public:
+        explicit CEventConnection(CID id)
+            : IAudioConnection(id)
+            , m_priority(1.0f)
+            , m_duration(0.0f)
+            , m_coalescingWindow(0.0f)
+            , m_maxInstances(1)
+        {
+        }
+
+        ~CEventConnection() override = default;
+
+        bool HasProperties() override
+        {
+            return true;
+        }
+
+        // Defaults match the runtime, attributes are only written when they differ.
+        float m_priority;
+        float m_duration;
+        float m_coalescingWindow;
+        int m_maxInstances;
+    };
+
+    using TEventConnectionPtr = AZStd::shared_ptr<CEventConnection>;
+
     //-------------------------------------------------------------------------------------------//
     class AmplitudeAudioSystemEditor : public IAudioSystemEditor
     {
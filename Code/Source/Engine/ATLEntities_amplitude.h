@@ -39,6 +39,17 @@ namespace Audio
             : bNeedsToUpdateEnvironments(false)
             , bHasPosition(bPassedHasPosition)
             , nAmID(nPassedAmID)
+            , nLodBand(0)
+            , bIsLodTracked(false)
+            , bHasPendingTransform(false)
+            , bHasPendingObstruction(false)
+            , bHasPendingOcclusion(false)
+            , vLocation(AM_Vec3(0.0f, 0.0f, 0.0f))
+            , vPendingLocation(AM_Vec3(0.0f, 0.0f, 0.0f))
+            , vPendingForward(AM_Vec3(0.0f, 1.0f, 0.0f))
+            , vPendingUp(AM_Vec3(0.0f, 0.0f, 1.0f))
+            , fPendingObstruction(0.0f)
+            , fPendingOcclusion(0.0f)
         {
         }
 
@@ -48,6 +59,19 @@ namespace Audio
         const bool bHasPosition;
         const AmEntityID nAmID;
         TEnvironmentImplMap cEnvironmentImplAmounts;
+
+        // Update LOD state, see AmplitudeUpdateLod. Changes to far objects are kept here until their band flushes them.
+        AZ::u8 nLodBand;
+        bool bIsLodTracked;
+        bool bHasPendingTransform;
+        bool bHasPendingObstruction;
+        bool bHasPendingOcclusion;
+        hmm_vec3 vLocation;
+        hmm_vec3 vPendingLocation;
+        hmm_vec3 vPendingForward;
+        hmm_vec3 vPendingUp;
+        float fPendingObstruction;
+        float fPendingOcclusion;
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,14 +90,34 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     struct SATLTriggerImplData_Amplitude : public IATLTriggerImplData
     {
-        explicit SATLTriggerImplData_Amplitude(const AmEventID nPassedAmID)
+        SATLTriggerImplData_Amplitude(
+            const AmEventID nPassedAmID,
+            const float fPassedPriority,
+            const AmTime fPassedCoalescingWindow,
+            const AZ::u32 nPassedMaxInstances,
+            const AmTime fPassedDuration)
             : nAmID(nPassedAmID)
+            , fPriority(fPassedPriority)
+            , fCoalescingWindow(fPassedCoalescingWindow)
+            , nMaxInstances(nPassedMaxInstances)
+            , fDuration(fPassedDuration)
         {
         }
 
         ~SATLTriggerImplData_Amplitude() override = default;
 
         const AmEventID nAmID;
+
+        // Weight of the trigger when competing for a voice, see AmplitudeVoiceLimiter.
+        const float fPriority;
+
+        // Maximum activations per entity within the coalescing window, see AmplitudeTriggerThrottle.
+        const AmTime fCoalescingWindow;
+        const AZ::u32 nMaxInstances;
+
+        // Expected duration of the event, after which a virtual instance is given up. Zero for loops and events
+        // of unknown duration, which stay virtual until stopped, see AmplitudeVoiceLimiter.
+        const AmTime fDuration;
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,16 +213,22 @@ namespace Audio
     {
         SATLAudioFileEntryData_Amplitude()
             : nAmBankID(kAmInvalidObjectId)
+            , pOwnedFileData(nullptr)
         {
         }
 
         explicit SATLAudioFileEntryData_Amplitude(AmBankID bankId)
             : nAmBankID(bankId)
+            , pOwnedFileData(nullptr)
         {
         }
 
         ~SATLAudioFileEntryData_Amplitude() override = default;
 
         AmBankID nAmBankID;
+
+        //! Copy of the file data the engine loaded a localized soundbank from. Unlike the ATL buffer, it stays
+        //! alive when the bank is retired during a language switch.
+        void* pOwnedFileData;
     };
 } // namespace Audio
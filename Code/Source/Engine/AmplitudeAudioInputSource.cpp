@@ -0,0 +1,529 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <Config.h>
+#include <Engine/AmplitudeAudioInputSource.h>
+
+namespace Audio
+{
+    // One second of audio at 48 kHz in stereo, used when the source configuration doesn't define a buffer size.
+    static constexpr AZStd::size_t kDefaultInputBufferSamples = 48000 * 2;
+
+    static AZStd::size_t NextPowerOfTwo(AZStd::size_t value)
+    {
+        AZStd::size_t result = 1;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+
+        return result;
+    }
+
+    static AZStd::size_t GetInputBufferSamples(const SAudioInputConfig& sourceConfig)
+    {
+        if (sourceConfig.m_bufferSize == 0 || sourceConfig.m_bitsPerSample == 0)
+        {
+            return kDefaultInputBufferSamples;
+        }
+
+        // Keep room for two buffers, so the producer can push the next one while the mixer consumes the current one.
+        return 2 * (sourceConfig.m_bufferSize / (sourceConfig.m_bitsPerSample >> 3));
+    }
+
+    AudioInputRingBuffer::AudioInputRingBuffer(const AZStd::size_t minCapacity)
+        : _buffer(NextPowerOfTwo(AZStd::max<AZStd::size_t>(minCapacity, 2)), 0.0f)
+        , _mask(_buffer.size() - 1)
+        , _writePosition(0)
+        , _readPosition(0)
+    {
+    }
+
+    AZStd::size_t AudioInputRingBuffer::Write(const float* const samples, const AZStd::size_t count)
+    {
+        const AZStd::size_t writePosition = _writePosition.load(AZStd::memory_order_relaxed);
+        const AZStd::size_t readPosition = _readPosition.load(AZStd::memory_order_acquire);
+
+        const AZStd::size_t toWrite = AZStd::min(count, _buffer.size() - (writePosition - readPosition));
+        const AZStd::size_t offset = writePosition & _mask;
+        const AZStd::size_t firstPart = AZStd::min(toWrite, _buffer.size() - offset);
+
+        memcpy(_buffer.data() + offset, samples, firstPart * sizeof(float));
+        memcpy(_buffer.data(), samples + firstPart, (toWrite - firstPart) * sizeof(float));
+
+        _writePosition.store(writePosition + toWrite, AZStd::memory_order_release);
+        return toWrite;
+    }
+
+    AZStd::size_t AudioInputRingBuffer::Read(float* const samples, const AZStd::size_t count)
+    {
+        const AZStd::size_t readPosition = _readPosition.load(AZStd::memory_order_relaxed);
+        const AZStd::size_t writePosition = _writePosition.load(AZStd::memory_order_acquire);
+
+        const AZStd::size_t toRead = AZStd::min(count, writePosition - readPosition);
+        const AZStd::size_t offset = readPosition & _mask;
+        const AZStd::size_t firstPart = AZStd::min(toRead, _buffer.size() - offset);
+
+        memcpy(samples, _buffer.data() + offset, firstPart * sizeof(float));
+        memcpy(samples + firstPart, _buffer.data(), (toRead - firstPart) * sizeof(float));
+
+        _readPosition.store(readPosition + toRead, AZStd::memory_order_release);
+        return toRead;
+    }
+
+    AZStd::size_t AudioInputRingBuffer::GetReadAvailable() const
+    {
+        return _writePosition.load(AZStd::memory_order_acquire) - _readPosition.load(AZStd::memory_order_acquire);
+    }
+
+    AZStd::size_t AudioInputRingBuffer::GetWriteAvailable() const
+    {
+        return _buffer.size() - GetReadAvailable();
+    }
+
+    AmplitudeAudioInputSource::AmplitudeAudioInputSource(const SAudioInputConfig& sourceConfig)
+        : _config(sourceConfig)
+        , _ringBuffer(GetInputBufferSamples(sourceConfig))
+        , _underrunFrames(0)
+        , _isRenderingEnabled(false)
+        , _activeRenderCount(0)
+    {
+        AudioStreamingRequestBus::Handler::BusConnect(_config.m_sourceId);
+    }
+
+    AmplitudeAudioInputSource::AmplitudeAudioInputSource(
+        const SAudioInputConfig& sourceConfig, SparkyStudios::Audio::Amplitude::ProceduralAudioRenderCallback renderCallback)
+        : _config(sourceConfig)
+        , _ringBuffer(0)
+        , _underrunFrames(0)
+        , _renderCallback(AZStd::move(renderCallback))
+        , _isRenderingEnabled(true)
+        , _activeRenderCount(0)
+    {
+        // Procedural sources are not fed through the streaming bus.
+    }
+
+    AmplitudeAudioInputSource::~AmplitudeAudioInputSource()
+    {
+        // The input is disconnected by the source manager, this may run on the mixer thread.
+        AZ_Assert(!AudioStreamingRequestBus::Handler::BusIsConnected(), "Audio input source destroyed while still connected.");
+    }
+
+    AZStd::size_t AmplitudeAudioInputSource::ReadStreamingInput(const AudioStreamData& data)
+    {
+        if (data.m_data == nullptr || data.m_sizeBytes == 0)
+        {
+            return 0;
+        }
+
+        if (_config.m_sampleType == AudioInputSampleType::Float)
+        {
+            const AZStd::size_t written =
+                _ringBuffer.Write(reinterpret_cast<const float*>(data.m_data), data.m_sizeBytes / sizeof(float));
+            return written * sizeof(float);
+        }
+
+        if (_config.m_sampleType == AudioInputSampleType::Int && _config.m_bitsPerSample == 16)
+        {
+            const auto* const samples = reinterpret_cast<const AZ::s16*>(data.m_data);
+            const AZStd::size_t sampleCount = data.m_sizeBytes / sizeof(AZ::s16);
+
+            AZStd::size_t written = 0;
+            while (written < sampleCount)
+            {
+                const AZStd::size_t blockSize = AZStd::min(ConversionBlockSamples, sampleCount - written);
+                for (AZStd::size_t i = 0; i < blockSize; ++i)
+                {
+                    _conversionBuffer[i] = static_cast<float>(samples[written + i]) / 32768.0f;
+                }
+
+                const AZStd::size_t blockWritten = _ringBuffer.Write(_conversionBuffer, blockSize);
+                written += blockWritten;
+
+                if (blockWritten < blockSize)
+                {
+                    // The ring buffer is full, the remaining samples are dropped.
+                    break;
+                }
+            }
+
+            return written * sizeof(AZ::s16);
+        }
+
+        AZLOG_WARN("[Amplitude] Audio input source %u uses an unsupported sample format.", _config.m_sourceId);
+        return 0;
+    }
+
+    AZStd::size_t AmplitudeAudioInputSource::ReadStreamingMultiTrackInput(AudioStreamMultiTrackData& data)
+    {
+        if (_config.m_sampleType != AudioInputSampleType::Float || _config.m_numChannels == 0)
+        {
+            AZLOG_WARN("[Amplitude] Audio input source %u only supports multi-track input of float samples.", _config.m_sourceId);
+            return 0;
+        }
+
+        // Interleave the tracks block by block into the conversion buffer.
+        const AZ::u32 channels = _config.m_numChannels;
+        const AZStd::size_t frameCount = data.m_sizeBytes / sizeof(float);
+        const AZStd::size_t blockFrames = ConversionBlockSamples / channels;
+
+        AZStd::size_t framesWritten = 0;
+        while (framesWritten < frameCount)
+        {
+            const AZStd::size_t blockSize = AZStd::min(blockFrames, frameCount - framesWritten);
+            for (AZ::u32 c = 0; c < channels; ++c)
+            {
+                const auto* const track = reinterpret_cast<const float*>(data.m_data[c]);
+                for (AZStd::size_t i = 0; i < blockSize; ++i)
+                {
+                    _conversionBuffer[i * channels + c] = track[framesWritten + i];
+                }
+            }
+
+            const AZStd::size_t samplesWritten = _ringBuffer.Write(_conversionBuffer, blockSize * channels);
+            framesWritten += samplesWritten / channels;
+
+            if (samplesWritten < blockSize * channels)
+            {
+                break;
+            }
+        }
+
+        return framesWritten * sizeof(float);
+    }
+
+    void AmplitudeAudioInputSource::ReadFrames(float* const output, const AmUInt64 frameCount)
+    {
+        const AZStd::size_t sampleCount = frameCount * _config.m_numChannels;
+
+        if (_renderCallback)
+        {
+            _activeRenderCount.fetch_add(1);
+
+            if (_isRenderingEnabled.load())
+            {
+                _renderCallback(output, frameCount, _config.m_numChannels);
+            }
+            else
+            {
+                memset(output, 0, sampleCount * sizeof(float));
+            }
+
+            _activeRenderCount.fetch_sub(1);
+            return;
+        }
+        const AZStd::size_t samplesRead = _ringBuffer.Read(output, sampleCount);
+
+        if (samplesRead < sampleCount)
+        {
+            memset(output + samplesRead, 0, (sampleCount - samplesRead) * sizeof(float));
+            _underrunFrames.fetch_add((sampleCount - samplesRead) / _config.m_numChannels, AZStd::memory_order_relaxed);
+        }
+    }
+
+    void AmplitudeAudioInputSource::DisableRendering()
+    {
+        _isRenderingEnabled.store(false);
+
+        while (_activeRenderCount.load() > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void AmplitudeAudioInputSource::DisconnectInput()
+    {
+        AudioStreamingRequestBus::Handler::BusDisconnect();
+    }
+
+    AmplitudeAudioInputSourceManager::AmplitudeAudioInputSourceManager()
+        : _nextProceduralSourceId(ProceduralSourceIdBase)
+    {
+    }
+
+    bool AmplitudeAudioInputSourceManager::CreateSource(const SAudioInputConfig& sourceConfig)
+    {
+        switch (sourceConfig.m_sourceType)
+        {
+        case AudioInputSourceType::ExternalStream:
+            [[fallthrough]];
+        case AudioInputSourceType::Synthesis:
+            break;
+        default:
+            AZLOG_WARN(
+                "[Amplitude] Unable to create audio input source %u, only external streams and synthesis sources are supported.",
+                sourceConfig.m_sourceId);
+            return false;
+        }
+
+        if (sourceConfig.m_numChannels == 0 || sourceConfig.m_sampleRate == 0)
+        {
+            AZLOG_ERROR("[Amplitude] Unable to create audio input source %u, invalid format.", sourceConfig.m_sourceId);
+            return false;
+        }
+
+        if (sourceConfig.m_numChannels > AmplitudeAudioInputSource::MaxChannelCount)
+        {
+            AZLOG_ERROR(
+                "[Amplitude] Unable to create audio input source %u, it has %u channels but at most %u are supported.",
+                sourceConfig.m_sourceId, sourceConfig.m_numChannels, AmplitudeAudioInputSource::MaxChannelCount);
+            return false;
+        }
+
+        AZStd::scoped_lock lock(_mutex);
+
+        if (_sources.find(sourceConfig.m_sourceId) != _sources.end())
+        {
+            AZLOG_ERROR("[Amplitude] An audio input source with ID %u already exists.", sourceConfig.m_sourceId);
+            return false;
+        }
+
+        _sources.emplace(
+            sourceConfig.m_sourceId, AZStd::allocate_shared<AmplitudeAudioInputSource>(AudioImplStdAllocator(), sourceConfig));
+        return true;
+    }
+
+    TAudioSourceId AmplitudeAudioInputSourceManager::CreateProceduralSource(
+        const SparkyStudios::Audio::Amplitude::ProceduralAudioSourceConfig& sourceConfig,
+        SparkyStudios::Audio::Amplitude::ProceduralAudioRenderCallback renderCallback)
+    {
+        if (!renderCallback || sourceConfig.m_channelCount == 0 || sourceConfig.m_sampleRate == 0 ||
+            sourceConfig.m_channelCount > AmplitudeAudioInputSource::MaxChannelCount)
+        {
+            AZLOG_ERROR("[Amplitude] Unable to create a procedural audio source, invalid format or render callback.");
+            return INVALID_AUDIO_SOURCE_ID;
+        }
+
+        AZStd::scoped_lock lock(_mutex);
+
+        SAudioInputConfig inputConfig;
+        inputConfig.m_sourceId = _nextProceduralSourceId++;
+        inputConfig.m_sourceType = AudioInputSourceType::Synthesis;
+        inputConfig.m_sampleType = AudioInputSampleType::Float;
+        inputConfig.m_sampleRate = sourceConfig.m_sampleRate;
+        inputConfig.m_numChannels = sourceConfig.m_channelCount;
+        inputConfig.m_bitsPerSample = sizeof(float) * 8;
+
+        _sources.emplace(
+            inputConfig.m_sourceId,
+            AZStd::allocate_shared<AmplitudeAudioInputSource>(AudioImplStdAllocator(), inputConfig, AZStd::move(renderCallback)));
+
+        return inputConfig.m_sourceId;
+    }
+
+    void AmplitudeAudioInputSourceManager::DestroySource(const TAudioSourceId sourceId)
+    {
+        TAudioInputSourcePtr source;
+
+        {
+            AZStd::scoped_lock lock(_mutex);
+
+            if (auto it = _sources.find(sourceId); it != _sources.end())
+            {
+                source = AZStd::move(it->second);
+                _sources.erase(it);
+            }
+
+            if (source)
+            {
+                for (auto binding = _pendingBindings.begin(); binding != _pendingBindings.end();)
+                {
+                    if (binding->second == source)
+                    {
+                        binding = _pendingBindings.erase(binding);
+                    }
+                    else
+                    {
+                        ++binding;
+                    }
+                }
+            }
+        }
+
+        if (source)
+        {
+            source->DisconnectInput();
+            source->DisableRendering();
+        }
+
+        // Decoders still streaming this source keep it alive until they are closed by the mixer.
+        source.reset();
+    }
+
+    void AmplitudeAudioInputSourceManager::DestroyAllSources()
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        _pendingBindings.clear();
+        _startedEvents.clear();
+
+        for (auto& [sourceId, source] : _sources)
+        {
+            source->DisconnectInput();
+            source->DisableRendering();
+        }
+
+        _sources.clear();
+    }
+
+    bool AmplitudeAudioInputSourceManager::BindSource(const TAudioSourceId sourceId, const TAudioEventID eventId)
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        if (auto it = _sources.find(sourceId); it != _sources.end())
+        {
+            _pendingBindings[eventId] = it->second;
+            return true;
+        }
+
+        return false;
+    }
+
+    void AmplitudeAudioInputSourceManager::UnbindSource(const TAudioEventID eventId)
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        // A started event left in the queue is skipped when its binding is not found anymore.
+        _pendingBindings.erase(eventId);
+    }
+
+    void AmplitudeAudioInputSourceManager::StartBinding(const TAudioEventID eventId)
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        if (_pendingBindings.find(eventId) != _pendingBindings.end())
+        {
+            _startedEvents.push_back(eventId);
+        }
+    }
+
+    void AmplitudeAudioInputSourceManager::ResetStartedBindings()
+    {
+        AZStd::scoped_lock lock(_mutex);
+        _startedEvents.clear();
+    }
+
+    TAudioInputSourcePtr AmplitudeAudioInputSourceManager::TakeBoundSource()
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        while (!_startedEvents.empty())
+        {
+            const TAudioEventID eventId = _startedEvents.front();
+            _startedEvents.pop_front();
+
+            if (auto it = _pendingBindings.find(eventId); it != _pendingBindings.end())
+            {
+                TAudioInputSourcePtr source = AZStd::move(it->second);
+                _pendingBindings.erase(it);
+
+                return source;
+            }
+        }
+
+        return nullptr;
+    }
+
+    size_t AmplitudeAudioInputSourceManager::GetPendingBindingCount()
+    {
+        AZStd::scoped_lock lock(_mutex);
+        return _pendingBindings.size();
+    }
+
+    AmplitudeAudioInputCodec::Decoder::Decoder(const Codec* codec, AmplitudeAudioInputSourceManager* sourceManager)
+        : Codec::Decoder(codec)
+        , _sourceManager(sourceManager)
+    {
+    }
+
+    bool AmplitudeAudioInputCodec::Decoder::Open([[maybe_unused]] AmOsString filePath)
+    {
+        _source = _sourceManager->TakeBoundSource();
+        if (!_source)
+        {
+            AZLOG_WARN("[Amplitude] An audio input sound was played without an audio input source bound to it.");
+            return false;
+        }
+
+        const SAudioInputConfig& config = _source->GetConfig();
+
+        // Audio input sources never end, they are played until the event is stopped.
+        m_format.SetAll(
+            config.m_sampleRate, config.m_numChannels, sizeof(float) * 8, AZStd::numeric_limits<AmUInt64>::max(),
+            config.m_numChannels * sizeof(float), AM_SAMPLE_FORMAT_FLOAT);
+
+        return true;
+    }
+
+    bool AmplitudeAudioInputCodec::Decoder::Close()
+    {
+        _source.reset();
+        return true;
+    }
+
+    AmUInt64 AmplitudeAudioInputCodec::Decoder::Load([[maybe_unused]] AmVoidPtr out)
+    {
+        AZLOG_ERROR("[Amplitude] Audio input sounds must be streamed.");
+        return 0;
+    }
+
+    AmUInt64 AmplitudeAudioInputCodec::Decoder::Stream(
+        AmVoidPtr out, const AmUInt64 bufferOffset, [[maybe_unused]] AmUInt64 seekOffset, const AmUInt64 length)
+    {
+        if (!_source)
+        {
+            return 0;
+        }
+
+        float* const output = static_cast<float*>(out) + bufferOffset * _source->GetConfig().m_numChannels;
+        _source->ReadFrames(output, length);
+
+        return length;
+    }
+
+    bool AmplitudeAudioInputCodec::Decoder::Seek([[maybe_unused]] AmUInt64 offset)
+    {
+        // Live sources cannot be seeked.
+        return false;
+    }
+
+    AmplitudeAudioInputCodec::AmplitudeAudioInputCodec(AmplitudeAudioInputSourceManager* sourceManager)
+        : Codec("o3de_audio_input")
+        , _sourceManager(sourceManager)
+    {
+    }
+
+    Codec::Decoder* AmplitudeAudioInputCodec::CreateDecoder() const
+    {
+        return ampoolnew(MemoryPoolKind::Codec, AmplitudeAudioInputCodec::Decoder, this, _sourceManager);
+    }
+
+    Codec::Encoder* AmplitudeAudioInputCodec::CreateEncoder() const
+    {
+        // Audio input sources are read only.
+        return nullptr;
+    }
+
+    bool AmplitudeAudioInputCodec::CanHandleFile(AmOsString filePath) const
+    {
+        return AZ::StringFunc::EndsWith(AM_OS_STRING_TO_STRING(filePath), kAssetAudioInputSourceFileExtension, false);
+    }
+} // namespace Audio
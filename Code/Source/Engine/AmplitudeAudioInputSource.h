@@ -0,0 +1,217 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+#include <IAudioInterfacesCommonData.h>
+#include <IAudioSystem.h>
+
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+#include <SparkyStudios/Audio/Amplitude/AmplitudeAudioBus.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Lock-free single producer, single consumer ring buffer of interleaved float PCM samples.
+    //! The storage is allocated once at construction, reads and writes never allocate nor lock.
+    class AudioInputRingBuffer
+    {
+    public:
+        AUDIO_IMPL_CLASS_ALLOCATOR(AudioInputRingBuffer);
+
+        //! Creates a ring buffer able to hold at least the given amount of samples.
+        explicit AudioInputRingBuffer(AZStd::size_t minCapacity);
+
+        //! Writes up to count samples. Must only be called by the producer thread.
+        //! @return The number of samples actually written.
+        AZStd::size_t Write(const float* samples, AZStd::size_t count);
+
+        //! Reads up to count samples. Must only be called by the consumer thread.
+        //! @return The number of samples actually read.
+        AZStd::size_t Read(float* samples, AZStd::size_t count);
+
+        //! Gets the number of samples available for reading.
+        [[nodiscard]] AZStd::size_t GetReadAvailable() const;
+
+        //! Gets the number of samples which can be written without overwriting unread data.
+        [[nodiscard]] AZStd::size_t GetWriteAvailable() const;
+
+        [[nodiscard]] AZStd::size_t GetCapacity() const
+        {
+            return _buffer.size();
+        }
+
+    private:
+        AZStd::vector<float, AudioImplStdAllocator> _buffer;
+        AZStd::size_t _mask;
+
+        // Monotonic positions, masked on access. Kept on separate cache lines to avoid false sharing
+        // between the producer and the consumer.
+        alignas(64) AZStd::atomic<AZStd::size_t> _writePosition;
+        alignas(64) AZStd::atomic<AZStd::size_t> _readPosition;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! An external PCM audio source (voice chat, video playback, procedural generator...).
+    //! Samples are pushed through the AudioStreamingRequestBus, addressed by source ID, and pulled by the
+    //! Amplitude mixer through the AmplitudeAudioInputCodec. Any thread can push samples, as long as only
+    //! one thread does it at a time for a given source.
+    //! Procedural sources have a render callback instead, which writes directly into the mixer buffer.
+    class AmplitudeAudioInputSource : public AudioStreamingRequestBus::Handler
+    {
+    public:
+        AUDIO_IMPL_CLASS_ALLOCATOR(AmplitudeAudioInputSource);
+
+        //! Multi-track input is interleaved by blocks of this amount of samples, which must hold at least one frame.
+        static constexpr AZStd::size_t ConversionBlockSamples = 1024;
+        static constexpr AZ::u32 MaxChannelCount = static_cast<AZ::u32>(ConversionBlockSamples);
+
+        explicit AmplitudeAudioInputSource(const SAudioInputConfig& sourceConfig);
+        AmplitudeAudioInputSource(
+            const SAudioInputConfig& sourceConfig, SparkyStudios::Audio::Amplitude::ProceduralAudioRenderCallback renderCallback);
+        ~AmplitudeAudioInputSource() override;
+
+        // AudioStreamingRequestBus
+        AZStd::size_t ReadStreamingInput(const AudioStreamData& data) override;
+        AZStd::size_t ReadStreamingMultiTrackInput(AudioStreamMultiTrackData& data) override;
+        // ~AudioStreamingRequestBus
+
+        //! Fills the output with interleaved float frames, padding with silence on underrun.
+        //! Called from the mixer thread.
+        void ReadFrames(float* output, AmUInt64 frameCount);
+
+        //! Stops invoking the render callback. Waits for a render in progress on the mixer thread to complete.
+        void DisableRendering();
+
+        //! Stops receiving samples from the streaming bus. Must be called by the thread destroying the source, as the
+        //! last reference may be released by a decoder on the mixer thread.
+        void DisconnectInput();
+
+        [[nodiscard]] const SAudioInputConfig& GetConfig() const
+        {
+            return _config;
+        }
+
+        [[nodiscard]] AZ::u64 GetUnderrunFrameCount() const
+        {
+            return _underrunFrames.load(AZStd::memory_order_relaxed);
+        }
+
+    private:
+        SAudioInputConfig _config;
+        AudioInputRingBuffer _ringBuffer;
+        AZStd::atomic<AZ::u64> _underrunFrames;
+
+        SparkyStudios::Audio::Amplitude::ProceduralAudioRenderCallback _renderCallback;
+        AZStd::atomic_bool _isRenderingEnabled;
+        AZStd::atomic<AZ::u32> _activeRenderCount;
+
+        // Scratch space used by the producer to convert integer samples to float.
+        float _conversionBuffer[ConversionBlockSamples];
+    };
+
+    using TAudioInputSourcePtr = AZStd::shared_ptr<AmplitudeAudioInputSource>;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Keeps track of the audio input sources created through the ATL.
+    class AmplitudeAudioInputSourceManager
+    {
+    public:
+        AmplitudeAudioInputSourceManager();
+
+        bool CreateSource(const SAudioInputConfig& sourceConfig);
+        TAudioSourceId CreateProceduralSource(
+            const SparkyStudios::Audio::Amplitude::ProceduralAudioSourceConfig& sourceConfig,
+            SparkyStudios::Audio::Amplitude::ProceduralAudioRenderCallback renderCallback);
+        void DestroySource(TAudioSourceId sourceId);
+        void DestroyAllSources();
+
+        //! Binds the given source to the event which is about to play it. Amplitude opens the decoder of the event
+        //! in a later frame, so the binding is kept pending until a decoder takes it, or until the event is unbound.
+        bool BindSource(TAudioSourceId sourceId, TAudioEventID eventId);
+
+        //! Drops the binding of the given event, if no decoder took it yet. Called when the event fails to
+        //! trigger, or is stopped or released before its decoder was opened.
+        void UnbindSource(TAudioEventID eventId);
+
+        //! Marks the binding of the given event as started, when the event is triggered in Amplitude. A virtual
+        //! event is bound, but not started until it gets a real voice.
+        void StartBinding(TAudioEventID eventId);
+
+        //! Returns the started bindings whose decoder was not opened during the last engine frame to the pending
+        //! state, so they are not taken by the decoder of another event.
+        void ResetStartedBindings();
+
+        //! Takes the source bound to the first event started in Amplitude, if any. Called by the input codec when a
+        //! decoder is opened. Amplitude opens the decoders of the events it started in the order it started them,
+        //! so each decoder takes the source of its own event, whatever the order the events were bound in.
+        TAudioInputSourcePtr TakeBoundSource();
+
+        [[nodiscard]] size_t GetPendingBindingCount();
+
+    private:
+        // Procedural sources are not created by the ATL, their IDs are allocated in a range the ATL never reaches.
+        static constexpr TAudioSourceId ProceduralSourceIdBase = 0x80000000;
+
+        AZStd::mutex _mutex;
+
+        AZStd::unordered_map<TAudioSourceId, TAudioInputSourcePtr> _sources;
+        AZStd::unordered_map<TAudioEventID, TAudioInputSourcePtr> _pendingBindings;
+        // Events of the pending bindings started in Amplitude, in the order they were triggered.
+        AZStd::deque<TAudioEventID> _startedEvents;
+        TAudioSourceId _nextProceduralSourceId;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Amplitude codec streaming audio input sources. Sounds meant to play an audio input source reference a
+    //! placeholder file with the ".amsource" extension, and must be set to stream.
+    class AmplitudeAudioInputCodec final : public Codec
+    {
+    public:
+        class Decoder final : public Codec::Decoder
+        {
+        public:
+            Decoder(const Codec* codec, AmplitudeAudioInputSourceManager* sourceManager);
+
+            bool Open(AmOsString filePath) override;
+            bool Close() override;
+            AmUInt64 Load(AmVoidPtr out) override;
+            AmUInt64 Stream(AmVoidPtr out, AmUInt64 bufferOffset, AmUInt64 seekOffset, AmUInt64 length) override;
+            bool Seek(AmUInt64 offset) override;
+
+        private:
+            AmplitudeAudioInputSourceManager* _sourceManager;
+            TAudioInputSourcePtr _source;
+        };
+
+        explicit AmplitudeAudioInputCodec(AmplitudeAudioInputSourceManager* sourceManager);
+
+        Codec::Decoder* CreateDecoder() const override;
+        Codec::Encoder* CreateEncoder() const override;
+        bool CanHandleFile(AmOsString filePath) const override;
+
+    private:
+        AmplitudeAudioInputSourceManager* _sourceManager;
+    };
+} // namespace Audio
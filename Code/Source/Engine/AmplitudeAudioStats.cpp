@@ -0,0 +1,107 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <Engine/AmplitudeAudioStats.h>
+
+namespace Audio
+{
+    static constexpr const char* kRequestTypeDataPointNames[] = {
+        "Amplitude::Requests::RegisterObject",
+        "Amplitude::Requests::UnregisterObject",
+        "Amplitude::Requests::ActivateTrigger",
+        "Amplitude::Requests::StopEvent",
+        "Amplitude::Requests::SetPosition",
+        "Amplitude::Requests::SetEnvironment",
+        "Amplitude::Requests::SetRtpc",
+        "Amplitude::Requests::ResetRtpc",
+        "Amplitude::Requests::SetSwitchState",
+        "Amplitude::Requests::SetObstructionOcclusion",
+        "Amplitude::Requests::SetListenerPosition",
+        "Amplitude::Requests::RegisterBank",
+        "Amplitude::Requests::UnregisterBank",
+    };
+
+    static_assert(
+        AZ_ARRAY_SIZE(kRequestTypeDataPointNames) == static_cast<size_t>(AudioRequestType::Count),
+        "A data point name is required for each request type.");
+
+    AmplitudeAudioStats::AmplitudeAudioStats()
+        : _requestCounts{}
+        , _activeEntityCount(0)
+        , _acceptedTriggerCount(0)
+        , _suppressedTriggerCount(0)
+        , _registeredBankBytes(0)
+    {
+    }
+
+    void AmplitudeAudioStats::EndFrame(const AZ::u32 realVoiceCount, const AZ::u32 virtualVoiceCount, const double engineUpdateTimeMs)
+    {
+        _engineUpdateTime.PushSample(engineUpdateTimeMs);
+
+        for (size_t i = 0; i < _requestCounts.size(); ++i)
+        {
+            AZ_PROFILE_DATAPOINT(Audio, _requestCounts[i], kRequestTypeDataPointNames[i]);
+        }
+
+        AZ_PROFILE_DATAPOINT(Audio, _activeEntityCount, "Amplitude::ActiveEntities");
+        AZ_PROFILE_DATAPOINT(Audio, realVoiceCount, "Amplitude::RealVoices");
+        AZ_PROFILE_DATAPOINT(Audio, virtualVoiceCount, "Amplitude::VirtualVoices");
+        AZ_PROFILE_DATAPOINT(Audio, _acceptedTriggerCount, "Amplitude::AcceptedTriggers");
+        AZ_PROFILE_DATAPOINT(Audio, _suppressedTriggerCount, "Amplitude::SuppressedTriggers");
+        AZ_PROFILE_DATAPOINT(Audio, _registeredBankBytes, "Amplitude::RegisteredBankBytes");
+        AZ_PROFILE_DATAPOINT(Audio, engineUpdateTimeMs, "Amplitude::EngineUpdateTimeMs");
+
+        {
+            AZStd::scoped_lock lock(_lastFrameMutex);
+
+            _lastFrame.m_requestCounts = _requestCounts;
+            _lastFrame.m_activeEntityCount = _activeEntityCount;
+            _lastFrame.m_realVoiceCount = realVoiceCount;
+            _lastFrame.m_virtualVoiceCount = virtualVoiceCount;
+            _lastFrame.m_acceptedTriggerCount = _acceptedTriggerCount;
+            _lastFrame.m_suppressedTriggerCount = _suppressedTriggerCount;
+            _lastFrame.m_registeredBankBytes = _registeredBankBytes;
+            _lastFrame.m_engineUpdateTimeMs = static_cast<float>(engineUpdateTimeMs);
+            _lastFrame.m_averageEngineUpdateTimeMs = static_cast<float>(_engineUpdateTime.GetAverage());
+            _lastFrame.m_maxEngineUpdateTimeMs = static_cast<float>(_engineUpdateTime.GetMaximum());
+        }
+
+        _requestCounts.fill(0);
+        _acceptedTriggerCount = 0;
+        _suppressedTriggerCount = 0;
+        _registeredBankBytes = 0;
+    }
+
+    AudioFrameStats AmplitudeAudioStats::GetLastFrame() const
+    {
+        AZStd::scoped_lock lock(_lastFrameMutex);
+        return _lastFrame;
+    }
+
+    void AmplitudeAudioStats::Clear()
+    {
+        _requestCounts.fill(0);
+        _activeEntityCount = 0;
+        _acceptedTriggerCount = 0;
+        _suppressedTriggerCount = 0;
+        _registeredBankBytes = 0;
+        _engineUpdateTime.Reset();
+
+        AZStd::scoped_lock lock(_lastFrameMutex);
+        _lastFrame = AudioFrameStats();
+    }
+} // namespace Audio
@@ -0,0 +1,84 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <SparkyStudios/Audio/Amplitude/AmplitudeAudioBus.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Per-frame counters of the Amplitude bridge.
+    //!
+    //! Requests are counted as they are handled on the audio thread. At the end of each audio update, the
+    //! counters are emitted as profiler data points, published for GetLastFrame(), and reset.
+    class AmplitudeAudioStats
+    {
+    public:
+        AmplitudeAudioStats();
+
+        void CountRequest(AudioRequestType type)
+        {
+            ++_requestCounts[static_cast<size_t>(type)];
+        }
+
+        void AddActiveEntity()
+        {
+            ++_activeEntityCount;
+        }
+
+        void RemoveActiveEntity()
+        {
+            if (_activeEntityCount > 0)
+            {
+                --_activeEntityCount;
+            }
+        }
+
+        void CountThrottledTrigger(bool accepted)
+        {
+            ++(accepted ? _acceptedTriggerCount : _suppressedTriggerCount);
+        }
+
+        void AddRegisteredBankBytes(AZ::u64 bytes)
+        {
+            _registeredBankBytes += bytes;
+        }
+
+        //! Emits the counters of the frame, and starts a new one.
+        void EndFrame(AZ::u32 realVoiceCount, AZ::u32 virtualVoiceCount, double engineUpdateTimeMs);
+
+        //! Gets the counters of the last completed frame. Can be called from any thread.
+        [[nodiscard]] AudioFrameStats GetLastFrame() const;
+
+        void Clear();
+
+    private:
+        AZStd::array<AZ::u32, static_cast<size_t>(AudioRequestType::Count)> _requestCounts;
+        AZ::u32 _activeEntityCount;
+        AZ::u32 _acceptedTriggerCount;
+        AZ::u32 _suppressedTriggerCount;
+        AZ::u64 _registeredBankBytes;
+        AZ::Statistics::RunningStatistic _engineUpdateTime;
+
+        mutable AZStd::mutex _lastFrameMutex;
+        AudioFrameStats _lastFrame;
+    };
+} // namespace Audio
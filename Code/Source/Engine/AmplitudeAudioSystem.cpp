@@ -14,12 +14,19 @@
 
 #include <platform.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/JSON/document.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AudioAllocators.h>
@@ -27,12 +34,93 @@
 
 #include <Config.h>
 #include <Engine/AmplitudeAudioSystem.h>
+#include <Engine/AmplitudeOfflineRender.h>
 #include <Engine/Common.h>
 
 using namespace SparkyStudios::Audio::Amplitude;
 
 #define AM_MEM_POOLS_COUNT static_cast<size_t>(MemoryPoolKind::COUNT)
 
+#if !defined(AMPLITUDE_RELEASE)
+AZ_CVAR_EXTERNED(bool, amp_debugOverlay);
+#endif // !AMPLITUDE_RELEASE
+
+static void amp_renderOffline(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.size() != 2)
+    {
+        AZLOG_ERROR("Usage: amp_renderOffline <timeline.json> <output.wav>");
+        return;
+    }
+
+    if (auto* const amplitude = SparkyStudios::Audio::Amplitude::AmplitudeAudioInterface::Get())
+    {
+        amplitude->RenderOffline(AZStd::string(arguments[0]), AZStd::string(arguments[1]));
+    }
+}
+
+AZ_CONSOLEFREEFUNC(
+    amp_renderOffline,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "Renders a timeline of triggers, positions and RTPC changes to a WAV file, as fast as possible. Requires the null driver and "
+    "no playing voice, and blocks the audio thread until done.");
+
+static void amp_captureRequests(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.size() != 1)
+    {
+        AZLOG_ERROR("Usage: amp_captureRequests <trace file | stop>");
+        return;
+    }
+
+    if (auto* const amplitude = SparkyStudios::Audio::Amplitude::AmplitudeAudioInterface::Get())
+    {
+        if (arguments[0] == "stop")
+        {
+            amplitude->StopRequestCapture();
+        }
+        else
+        {
+            amplitude->StartRequestCapture(AZStd::string(arguments[0]));
+        }
+    }
+}
+
+AZ_CONSOLEFREEFUNC(
+    amp_captureRequests,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "Records the calls made to the Amplitude implementation into a binary trace file, until called again with 'stop'.");
+
+static void amp_replayRequests(const AZ::ConsoleCommandContainer& arguments)
+{
+    float speed = 1.0f;
+
+    if (arguments.empty() || arguments.size() > 2 ||
+        (arguments.size() == 2 && !AZ::StringFunc::LooksLikeFloat(AZStd::string(arguments[1]).c_str(), &speed)))
+    {
+        AZLOG_ERROR("Usage: amp_replayRequests <trace file> [speed, 0 for as fast as possible]");
+        return;
+    }
+
+    if (auto* const amplitude = SparkyStudios::Audio::Amplitude::AmplitudeAudioInterface::Get())
+    {
+        amplitude->ReplayRequestCapture(AZStd::string(arguments[0]), speed);
+    }
+}
+
+AZ_CONSOLEFREEFUNC(
+    amp_replayRequests,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "Replays a request trace recorded by amp_captureRequests, at its original pace times the given speed.");
+
+AZ_CVAR(
+    bool,
+    amp_telemetry,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "Records the Amplitude performance counters of each audio update to the telemetry files set in runtime_settings.json.");
+
 namespace Audio
 {
     namespace Amplitude
@@ -98,6 +186,89 @@ namespace Audio
 
     static bool gAudioDeviceInitializationEvent = false;
 
+    static constexpr char kPlatformMappingsKey[] = "platform_mappings";
+    static constexpr char kAssetPlatformKey[] = "asset_platform";
+    static constexpr char kEnginePlatformKey[] = "engine_platform";
+    static constexpr char kBankSubPathKey[] = "bank_sub_path";
+    static constexpr char kVoiceLimiterKey[] = "voice_limiter";
+    static constexpr char kMaxRealVoicesKey[] = "max_real_voices";
+    static constexpr char kMaxVirtualTimeKey[] = "max_virtual_time";
+    static constexpr char kDistanceReferenceKey[] = "distance_reference";
+    static constexpr char kOcclusionKey[] = "occlusion";
+    static constexpr char kEnabledKey[] = "enabled";
+    static constexpr char kRaysPerFrameKey[] = "rays_per_frame";
+    static constexpr char kSmoothingTimeKey[] = "smoothing_time";
+    static constexpr char kMaxDistanceKey[] = "max_distance";
+    static constexpr char kUpdateLodKey[] = "update_lod";
+    static constexpr char kBandsKey[] = "bands";
+    static constexpr char kIntervalKey[] = "interval";
+    static constexpr char kPanningKey[] = "panning";
+    static constexpr char kSpeakersKey[] = "speakers";
+    static constexpr char kHeadphonesKey[] = "headphones";
+    static constexpr char kSpatialGridKey[] = "spatial_grid";
+    static constexpr char kBusGainsKey[] = "bus_gains";
+    static constexpr char kRampTimeKey[] = "ramp_time";
+    static constexpr char kCellSizeKey[] = "cell_size";
+    static constexpr char kTelemetryKey[] = "telemetry";
+    static constexpr char kFormatKey[] = "format";
+    static constexpr char kPathKey[] = "path";
+    static constexpr char kMaxFileSizeKey[] = "max_file_size";
+    static constexpr char kMaxFilesKey[] = "max_files";
+
+    static constexpr const char* kPanningTierNames[] = { "stereo", "binaural_low", "binaural_medium", "binaural_high" };
+
+    static bool ParsePanningTier(const char* name, PanningTier& tier)
+    {
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(kPanningTierNames); ++i)
+        {
+            if (azstricmp(name, kPanningTierNames[i]) == 0)
+            {
+                tier = static_cast<PanningTier>(i);
+                return true;
+            }
+        }
+
+        AZLOG_WARN("[Amplitude] Unknown panning tier '%s'.", name);
+        return false;
+    }
+
+    static bool ReadJsonFile(const AZStd::string& path, rapidjson::Document& document)
+    {
+        AZ::IO::FileIOStream fileStream;
+        if (!fileStream.Open(path.c_str(), AZ::IO::OpenMode::ModeRead))
+        {
+            return false;
+        }
+
+        const AZ::IO::SizeType fileSize = fileStream.GetLength();
+        AZStd::vector<char> fileBuffer(fileSize + 1);
+        fileBuffer[fileSize] = '\0';
+
+        if (fileStream.Read(fileSize, fileBuffer.data()) != fileSize)
+        {
+            return false;
+        }
+
+        document.Parse(fileBuffer.data());
+        return !document.HasParseError();
+    }
+
+    // Reads the amplitude_id attribute of a connection node. Control files saved by older versions of the editor don't
+    // have it, their connections are resolved by name.
+    static bool ReadConnectionId(const AZ::rapidxml::xml_node<char>* node, AmObjectID& id)
+    {
+        const auto* idAttr = node->first_attribute(XmlTags::kIdAttribute, 0, false);
+        if (idAttr == nullptr || idAttr->value()[0] == '\0')
+        {
+            return false;
+        }
+
+        char* end = nullptr;
+        id = strtoull(idAttr->value(), &end, 10);
+
+        return *end == '\0' && id != kAmInvalidObjectId;
+    }
+
     static int GetAssetType(const SATLSourceData* sourceData)
     {
         if (!sourceData)
@@ -112,10 +283,21 @@ namespace Audio
         : _globalGameObjectId(GLOBAL_AUDIO_OBJECT_ID)
         , _defaultListenerGameObjectId(kAmInvalidObjectId)
         , _initBankId(kAmInvalidObjectId)
+        , _languageSwitchState(ELanguageSwitchState::Idle)
+        , _panningMode(PanningMode::Speakers)
+        , _speakersPanningTier(PanningTier::Stereo)
+        , _headphonesPanningTier(PanningTier::BinauralHigh)
+        , _appliedPanningTier(PanningTier::Stereo)
+        , _updateLod(&_listeners)
+        , _voiceLimiter(&_listeners, &_audioInputSources)
+        , _occlusionService(&_listeners, &_spatialGrid)
+        , _audioInputSources()
+        , _audioInputCodec(&_audioInputSources)
         , _fileLoader()
         , _engine(Engine::GetInstance())
 #if !defined(AMPLITUDE_RELEASE)
         , _isCommSystemInitialized(false)
+        , _debugSnapshotElapsedMs(0.0f)
 #endif // !AMPLITUDE_RELEASE
     {
         if (assetsPlatformName && assetsPlatformName[0] != '\0')
@@ -199,6 +381,8 @@ namespace Audio
 
     void AmplitudeAudioSystem::OnAudioSystemRefresh()
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         if (_engine->IsInitialized())
         {
             if (_initBankId != kAmInvalidObjectId)
@@ -212,6 +396,9 @@ namespace Audio
                 _initBankId = kAmInvalidObjectId;
                 AZ_Assert(false, "[Amplitude] Failed to load %s !", kInitBankFile);
             }
+
+            // The controls are parsed again after a refresh, with the caches built from their last version.
+            LoadControlCache();
         }
         else
         {
@@ -225,12 +412,64 @@ namespace Audio
 
         if (_engine->IsInitialized())
         {
-            _engine->AdvanceFrame(static_cast<AmTime>(updateIntervalMs) / kAmSecond);
+            RunPendingPanningChanges();
+            RunPendingOfflineRenders();
+            RunPendingRequestTraceCommands();
+
+            _requestRecorder.RecordUpdate(updateIntervalMs);
+
+            if (_requestReplayer.IsRunning() && !_requestReplayer.Advance(this, updateIntervalMs))
+            {
+                AZLOG_INFO("[Amplitude] Request trace replayed, %llu requests.", _requestReplayer.GetRequestCount());
+                _requestReplayer.Stop(this);
+            }
+
+            UpdateFrame(updateIntervalMs);
+        }
+    }
+
+    void AmplitudeAudioSystem::UpdateFrame(const float updateIntervalMs)
+    {
+        UpdateLanguageSwitch();
+
+        const AmTime deltaTime = static_cast<AmTime>(updateIntervalMs) / kAmSecond;
+
+        _listeners.Update(_engine);
+        _updateLod.Update(_engine);
+        _triggerThrottle.Update(deltaTime);
+        _voiceLimiter.Update(_engine, deltaTime);
+        _occlusionService.Update(_engine, _voiceLimiter, deltaTime);
+        _sendRamps.Update(_engine, _voiceLimiter, deltaTime);
+        _listeners.PublishVoiceCounts();
+
+        AZStd::chrono::duration<double, AZStd::milli> engineUpdateTime;
+
+        {
+            // Tagged with the panning tier and the real voice count, to compare the per-voice cost of each tier.
+            AZ_PROFILE_SCOPE(
+                Audio, "Amplitude::AdvanceFrame - %s - %u voices", kPanningTierNames[static_cast<size_t>(_appliedPanningTier)],
+                _voiceLimiter.GetRealVoiceCount());
+
+            const auto engineUpdateStart = AZStd::chrono::steady_clock::now();
+            _engine->AdvanceFrame(deltaTime);
+            engineUpdateTime = AZStd::chrono::steady_clock::now() - engineUpdateStart;
         }
+
+        // Audio input decoders are opened during the frame following the trigger of their event.
+        _audioInputSources.ResetStartedBindings();
+
+        _stats.EndFrame(_voiceLimiter.GetRealVoiceCount(), _voiceLimiter.GetVirtualVoiceCount(), engineUpdateTime.count());
+        RecordTelemetry();
+
+#if !defined(AMPLITUDE_RELEASE)
+        PublishDebugSnapshot(updateIntervalMs);
+#endif // !AMPLITUDE_RELEASE
     }
 
     EAudioRequestStatus AmplitudeAudioSystem::Initialize()
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         RegisterLogFunc(Amplitude::Log::Write);
 
         const AZ::IO::FixedMaxPath projectPath(AZ::Utils::GetProjectPath());
@@ -258,6 +497,12 @@ namespace Audio
 
         _engine->SetFileLoader(_fileLoader);
 
+        // Streams external PCM sources created through CreateAudioSource() into the mixer.
+        Codec::Register(&_audioInputCodec);
+
+        // Selected with "null" as the driver of the engine configuration, for headless runs.
+        Driver::Register(&_nullDriver);
+
         if (!_engine->Initialize(AM_OS_STRING("audio_config.amconfig")))
         {
             AZLOG_ERROR("Amplitude Engine has failed to initialize.");
@@ -271,6 +516,11 @@ namespace Audio
             AZLOG_WARN("Amplitude::Engine::AddEntity() failed.");
         }
 
+        _voiceLimiter.SetGlobalEntityId(_globalGameObjectId);
+
+        LoadRuntimeSettings();
+        ApplyPanningTier();
+
         const bool result = _engine->LoadSoundBank(AM_STRING_TO_OS_STRING(kInitBankFile));
         _initBankId = 1;
 
@@ -281,15 +531,24 @@ namespace Audio
             AZ_Assert(false, "<Amplitude> Failed to load %s !", kInitBankFile);
         }
 
+        // Loaded before the ATL parses the control files.
+        LoadControlCache();
+
         return EAudioRequestStatus::Success;
     }
 
     EAudioRequestStatus AmplitudeAudioSystem::ShutDown()
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         // TODO: Audio device status callback
 
         if (_engine->IsInitialized())
         {
+            // The objects of an unfinished replay are released while their events can still be stopped.
+            _requestReplayer.Stop(this);
+            _requestRecorder.Close();
+
             // UnRegister the DummyGameObject
             _engine->RemoveEntity(&_globalGameObject);
 
@@ -298,11 +557,30 @@ namespace Audio
                 AZLOG_WARN("Amplitude::Engine::RemoveEntity() failed.");
             }
 
+            ReleaseRetiredSoundBanks();
+            _languageSwitchState = ELanguageSwitchState::Idle;
+
+            _listeners.Clear();
+            _updateLod.Clear();
+            _triggerThrottle.Clear();
+            _voiceLimiter.Clear();
+            _occlusionService.Clear();
+            _sendRamps.Clear();
+            _spatialGrid.Clear();
+            _environments.Clear();
+            _controlCache.Clear();
+            _telemetry.Stop();
+            _stats.Clear();
+
             _engine->UnloadSoundBanks();
 
             _engine->Deinitialize();
         }
 
+        _audioInputSources.DestroyAllSources();
+        Codec::Unregister(&_audioInputCodec);
+        Driver::Unregister(&_nullDriver);
+
         // Terminate the Memory Manager
         if (MemoryManager::IsInitialized())
         {
@@ -320,6 +598,8 @@ namespace Audio
 
     EAudioRequestStatus AmplitudeAudioSystem::StopAllSounds()
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         if (_engine->IsInitialized())
         {
             _engine->StopAll();
@@ -332,9 +612,13 @@ namespace Audio
     EAudioRequestStatus AmplitudeAudioSystem::RegisterAudioObject(
         IATLAudioObjectData* const audioObjectData, [[maybe_unused]] const char* const objectName)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::RegisterObject);
+        _requestRecorder.RecordRegisterObject(audioObjectData);
+
         if (audioObjectData && _engine->IsInitialized())
         {
-            const auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
+            auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
 
             const Entity entity = _engine->AddEntity(implObjectData->nAmID);
 
@@ -342,6 +626,15 @@ namespace Audio
             {
                 AZLOG_WARN("Amplitude::Engine::AddEntity() failed.");
             }
+            else
+            {
+                _stats.AddActiveEntity();
+
+                if (implObjectData->bHasPosition)
+                {
+                    _updateLod.AddObject(implObjectData);
+                }
+            }
 
             return BoolToARS(entity.Valid());
         }
@@ -352,10 +645,20 @@ namespace Audio
 
     EAudioRequestStatus AmplitudeAudioSystem::UnregisterAudioObject(IATLAudioObjectData* const audioObjectData)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::UnregisterObject);
+        _requestRecorder.RecordUnregisterObject(audioObjectData);
+
         if (audioObjectData && _engine->IsInitialized())
         {
-            const auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
+            auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
 
+            _updateLod.RemoveObject(implObjectData);
+            _triggerThrottle.ForgetEntity(implObjectData->nAmID);
+            _occlusionService.ForgetEntity(implObjectData->nAmID);
+            _voiceLimiter.ForgetEntity(implObjectData->nAmID);
+            _sendRamps.ForgetEntity(implObjectData->nAmID);
+            _spatialGrid.RemoveEntity(implObjectData->nAmID);
             _engine->RemoveEntity(implObjectData->nAmID);
             const Entity entity = _engine->GetEntity(implObjectData->nAmID);
 
@@ -363,6 +666,10 @@ namespace Audio
             {
                 AZLOG_WARN("Amplitude::Engine::RemoveEntity() failed.");
             }
+            else
+            {
+                _stats.RemoveActiveEntity();
+            }
 
             return BoolToARS(!entity.Valid());
         }
@@ -371,8 +678,115 @@ namespace Audio
         return EAudioRequestStatus::Failure;
     }
 
+    EAudioRequestStatus AmplitudeAudioSystem::RegisterAudioObjects(const AZStd::vector<IATLAudioObjectData*>& audioObjects)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        if (!_engine->IsInitialized())
+        {
+            AZLOG_WARN("[Amplitude] Unable to register %zu audio objects, the engine is not initialized.", audioObjects.size());
+            return EAudioRequestStatus::Failure;
+        }
+
+        size_t failedCount = 0;
+
+        for (IATLAudioObjectData* const audioObjectData : audioObjects)
+        {
+            _stats.CountRequest(AudioRequestType::RegisterObject);
+            _requestRecorder.RecordRegisterObject(audioObjectData);
+
+            auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
+
+            if (implObjectData == nullptr || !_engine->AddEntity(implObjectData->nAmID).Valid())
+            {
+                ++failedCount;
+                continue;
+            }
+
+            _stats.AddActiveEntity();
+
+            if (implObjectData->bHasPosition)
+            {
+                _updateLod.AddObject(implObjectData);
+            }
+        }
+
+        if (failedCount > 0)
+        {
+            AZLOG_WARN("[Amplitude] Unable to register %zu of %zu audio objects.", failedCount, audioObjects.size());
+        }
+
+        return BoolToARS(failedCount == 0);
+    }
+
+    EAudioRequestStatus AmplitudeAudioSystem::UnregisterAudioObjects(const AZStd::vector<IATLAudioObjectData*>& audioObjects)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        if (!_engine->IsInitialized())
+        {
+            AZLOG_WARN("[Amplitude] Unable to unregister %zu audio objects, the engine is not initialized.", audioObjects.size());
+            return EAudioRequestStatus::Failure;
+        }
+
+        size_t failedCount = 0;
+
+        _unregisteredEntityIds.clear();
+        _unregisteredEntityIds.reserve(audioObjects.size());
+
+        for (IATLAudioObjectData* const audioObjectData : audioObjects)
+        {
+            _stats.CountRequest(AudioRequestType::UnregisterObject);
+            _requestRecorder.RecordUnregisterObject(audioObjectData);
+
+            if (const auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData))
+            {
+                _unregisteredEntityIds.push_back(implObjectData->nAmID);
+            }
+            else
+            {
+                ++failedCount;
+            }
+        }
+
+        // The lists of the services are walked once, looking up each of their entries in the sorted IDs. An object
+        // listed twice is only removed once.
+        AZStd::sort(_unregisteredEntityIds.begin(), _unregisteredEntityIds.end());
+        _unregisteredEntityIds.erase(
+            AZStd::unique(_unregisteredEntityIds.begin(), _unregisteredEntityIds.end()), _unregisteredEntityIds.end());
+
+        _updateLod.RemoveObjects(_unregisteredEntityIds);
+        _triggerThrottle.ForgetEntities(_unregisteredEntityIds);
+        _occlusionService.ForgetEntities(_unregisteredEntityIds);
+        _voiceLimiter.ForgetEntities(_unregisteredEntityIds);
+        _sendRamps.ForgetEntities(_unregisteredEntityIds);
+        _spatialGrid.RemoveEntities(_unregisteredEntityIds);
+
+        // Only the entities actually registered are counted out of the active ones.
+        for (const AmEntityID entityId : _unregisteredEntityIds)
+        {
+            if (!_engine->GetEntity(entityId).Valid())
+            {
+                ++failedCount;
+                continue;
+            }
+
+            _engine->RemoveEntity(entityId);
+            _stats.RemoveActiveEntity();
+        }
+
+        if (failedCount > 0)
+        {
+            AZLOG_WARN("[Amplitude] Unable to unregister %zu of %zu audio objects.", failedCount, audioObjects.size());
+        }
+
+        return BoolToARS(failedCount == 0);
+    }
+
     EAudioRequestStatus AmplitudeAudioSystem::ResetAudioObject(IATLAudioObjectData* const audioObjectData)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         if (audioObjectData)
         {
             auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
@@ -452,6 +866,10 @@ namespace Audio
         IATLEventData* const eventData,
         const SATLSourceData* const sourceData)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::ActivateTrigger);
+        _requestRecorder.RecordActivateTrigger(audioObjectData, triggerData, eventData);
+
         auto result = EAudioRequestStatus::Failure;
 
         const auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
@@ -476,38 +894,79 @@ namespace Audio
             case eAAT_SOURCE:
                 {
                     AZ_Assert(sourceData, "SourceData not provided for source type!");
+                    AZLOG_WARN(
+                        "[Amplitude] Unable to activate a trigger with a file audio source, only PCM streams are supported. Source ID: %u",
+                        sourceData->m_sourceInfo.m_sourceId);
                     break;
                 }
 
             case eAAT_STREAM:
-                [[fallthrough]];
+                {
+                    AZ_Assert(sourceData, "SourceData not provided for stream type!");
+
+                    const bool accepted = _triggerThrottle.TryActivate(
+                        implObjectData->nAmID, implTriggerData->nAmID, implTriggerData->fCoalescingWindow, implTriggerData->nMaxInstances);
+                    _stats.CountThrottledTrigger(accepted);
+
+                    if (!accepted)
+                    {
+                        break;
+                    }
+
+                    // The decoder opened for this event, once Amplitude triggers it for real, pulls its samples from the
+                    // bound source. A virtual event keeps its binding until it gets a real voice.
+                    if (!_audioInputSources.BindSource(sourceData->m_sourceInfo.m_sourceId, implEventData->nATLID))
+                    {
+                        AZLOG_WARN(
+                            "[Amplitude] Unable to activate a trigger, the audio input source %u does not exist.",
+                            sourceData->m_sourceInfo.m_sourceId);
+                        break;
+                    }
+
+                    implEventData->nSourceId = sourceData->m_sourceInfo.m_sourceId;
+
+                    if (_voiceLimiter.Play(
+                            _engine, implEventData, implTriggerData->nAmID, entityId, implTriggerData->fPriority,
+                            implTriggerData->fDuration))
+                    {
+                        result = EAudioRequestStatus::Success;
+                    }
+                    else
+                    {
+                        _audioInputSources.UnbindSource(implEventData->nATLID);
+                        implEventData->nSourceId = INVALID_AUDIO_SOURCE_ID;
+                    }
+                    break;
+                }
+
             case eAAT_NONE:
                 [[fallthrough]];
             default:
                 {
-                    const Entity entity = _engine->GetEntity(entityId);
 #if !defined(AMPLITUDE_RELEASE)
-                    if (entityId != kAmInvalidObjectId && !entity.Valid())
+                    if (entityId != kAmInvalidObjectId && !_engine->GetEntity(entityId).Valid())
                     {
                         CallLogFunc("Unable to find an entity with ID: %ul", entityId);
                     }
 #endif
 
-                    if (const EventHandle event = _engine->GetEventHandle(implTriggerData->nAmID))
+                    // Keyed by audio object, as all the non-positional objects play on the global entity.
+                    const bool accepted = _triggerThrottle.TryActivate(
+                        implObjectData->nAmID, implTriggerData->nAmID, implTriggerData->fCoalescingWindow, implTriggerData->nMaxInstances);
+                    _stats.CountThrottledTrigger(accepted);
+
+                    if (!accepted)
                     {
-                        if (const EventCanceler canceler = _engine->Trigger(event, entity); canceler.Valid())
-                        {
-                            implEventData->audioEventState = eAES_PLAYING;
-                            implEventData->eventCanceler = canceler;
-                            result = EAudioRequestStatus::Success;
-                        }
+                        // Too many activations of this trigger on this audio object within its coalescing window.
+                        break;
                     }
-                    else
+
+                    // The event may be played virtually if the voice budget is exhausted.
+                    if (_voiceLimiter.Play(
+                            _engine, implEventData, implTriggerData->nAmID, entityId, implTriggerData->fPriority,
+                            implTriggerData->fDuration))
                     {
-                        AZLOG_WARN(
-                            "[Amplitude] Unable to activate a trigger, the associated Amplitude event with ID %l has not been found in "
-                            "loaded banks.",
-                            implTriggerData->nAmID);
+                        result = EAudioRequestStatus::Success;
                     }
                     break;
                 }
@@ -522,12 +981,27 @@ namespace Audio
     }
 
     EAudioRequestStatus AmplitudeAudioSystem::StopEvent(
-        [[maybe_unused]] IATLAudioObjectData* const audioObjectData, const IATLEventData* const eventData)
+        IATLAudioObjectData* const audioObjectData, const IATLEventData* const eventData)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::StopEvent);
+        _requestRecorder.RecordStopEvent(audioObjectData, eventData);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (auto* const implEventData = dynamic_cast<const SATLEventData_Amplitude*>(eventData))
         {
+            // An event stopped before its decoder was opened must not leave its source to the next one.
+            if (implEventData->nSourceId != INVALID_AUDIO_SOURCE_ID)
+            {
+                _audioInputSources.UnbindSource(implEventData->nATLID);
+            }
+
+            if (_voiceLimiter.Stop(implEventData))
+            {
+                return EAudioRequestStatus::Success;
+            }
+
             switch (implEventData->audioEventState)
             {
             case eAES_PLAYING:
@@ -560,6 +1034,8 @@ namespace Audio
 
     EAudioRequestStatus AmplitudeAudioSystem::StopAllEvents([[maybe_unused]] IATLAudioObjectData* const audioObjectData)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         // TODO: Cancel all events
         return EAudioRequestStatus::Success;
     }
@@ -567,16 +1043,29 @@ namespace Audio
     EAudioRequestStatus AmplitudeAudioSystem::SetPosition(
         IATLAudioObjectData* const audioObjectData, const SATLWorldPosition& worldPosition)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::SetPosition);
+        _requestRecorder.RecordSetPosition(audioObjectData, worldPosition);
+
         auto result = EAudioRequestStatus::Failure;
 
-        if (const auto* implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData))
+        if (auto* implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData))
         {
             if (Entity entity = _engine->GetEntity(implObjectData->nAmID); entity.Valid())
             {
-                entity.SetLocation(ATLVec3ToAmVec3(worldPosition.GetPositionVec()));
-                entity.SetOrientation(
-                    ATLVec3ToAmVec3(worldPosition.GetForwardVec().GetNormalized()),
-                    ATLVec3ToAmVec3(worldPosition.GetUpVec().GetNormalized()));
+                const hmm_vec3 location = ATLVec3ToAmVec3(worldPosition.GetPositionVec());
+                const hmm_vec3 forward = ATLVec3ToAmVec3(worldPosition.GetForwardVec().GetNormalized());
+                const hmm_vec3 up = ATLVec3ToAmVec3(worldPosition.GetUpVec().GetNormalized());
+
+                // The spatial grid always has the latest position, even when the LOD defers the Amplitude update.
+                _spatialGrid.SetLocation(implObjectData->nAmID, location);
+
+                // Far objects are moved when their update LOD band is flushed.
+                if (_updateLod.DeferTransform(implObjectData, location, forward, up))
+                {
+                    entity.SetLocation(location);
+                    entity.SetOrientation(forward, up);
+                }
             }
             else
             {
@@ -603,9 +1092,13 @@ namespace Audio
     EAudioRequestStatus AmplitudeAudioSystem::SetEnvironment(
         IATLAudioObjectData* const audioObjectData, const IATLEnvironmentImplData* const environmentData, const float amount)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::SetEnvironment);
+        _requestRecorder.RecordSetEnvironment(audioObjectData, environmentData, amount);
+
         auto result = EAudioRequestStatus::Failure;
 
-        const auto* implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
+        auto* implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
 
         if (const auto* implEnvironmentData = dynamic_cast<const SATLEnvironmentImplData_Amplitude*>(environmentData);
             implObjectData && implEnvironmentData)
@@ -614,11 +1107,11 @@ namespace Audio
             {
             case eAAET_BUS:
                 {
-                    if (const Bus bus = _engine->FindBus(implEnvironmentData->nAmEnvID); bus.Valid())
-                    {
-                        // TODO: Set gain? Per object bus gain?
-                    }
+                    if (const Bus bus = _engine->FindBus(implEnvironmentData->nAmEnvID); !bus.Valid())
+                        break;
 
+                    // Amplitude has no per-entity bus send, and the gain of a bus is shared by all the entities routed to it.
+                    // Bus environments are not applied per object, use an effect environment for per-object sends.
                     result = EAudioRequestStatus::Success;
                     break;
                 }
@@ -639,11 +1132,11 @@ namespace Audio
                     if (!env.Valid())
                         break;
 
-                    Entity entity = _engine->GetEntity(implObjectData->nAmID);
-                    if (!entity.Valid())
+                    if (const Entity entity = _engine->GetEntity(implObjectData->nAmID); !entity.Valid())
                         break;
 
-                    entity.SetEnvironmentFactor(env.GetId(), amount);
+                    // Ramped at block rate, and applied as a send of this object only.
+                    _sendRamps.SetEnvironmentAmount(implObjectData->nAmID, env.GetId(), amount);
 
                     result = EAudioRequestStatus::Success;
                     break;
@@ -663,8 +1156,12 @@ namespace Audio
     }
 
     EAudioRequestStatus AmplitudeAudioSystem::SetRtpc(
-        [[maybe_unused]] IATLAudioObjectData* const audioObjectData, const IATLRtpcImplData* const rtpcData, const float value)
+        IATLAudioObjectData* const audioObjectData, const IATLRtpcImplData* const rtpcData, const float value)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::SetRtpc);
+        _requestRecorder.RecordSetRtpc(audioObjectData, rtpcData, value);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (const auto* const implRtpcData = dynamic_cast<const SATLRtpcImplData_Amplitude*>(rtpcData))
@@ -681,8 +1178,12 @@ namespace Audio
     }
 
     EAudioRequestStatus AmplitudeAudioSystem::SetSwitchState(
-        [[maybe_unused]] IATLAudioObjectData* const audioObjectData, const IATLSwitchStateImplData* const switchStateData)
+        IATLAudioObjectData* const audioObjectData, const IATLSwitchStateImplData* const switchStateData)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::SetSwitchState);
+        _requestRecorder.RecordSetSwitchState(audioObjectData, switchStateData);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (const auto* const implSwitchData = dynamic_cast<const SATLSwitchStateImplData_Amplitude*>(switchStateData))
@@ -701,9 +1202,13 @@ namespace Audio
     EAudioRequestStatus AmplitudeAudioSystem::SetObstructionOcclusion(
         IATLAudioObjectData* const audioObjectData, const float obstruction, const float occlusion)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::SetObstructionOcclusion);
+        _requestRecorder.RecordSetObstructionOcclusion(audioObjectData, obstruction, occlusion);
+
         if (audioObjectData)
         {
-            const auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
+            auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(audioObjectData);
 
             Entity entity = _engine->GetEntity(implObjectData->nAmID);
 
@@ -712,8 +1217,18 @@ namespace Audio
                 AZLOG_WARN("[Amplitude] Amplitude::Engine::GetEntity() failed with entity ID %lu", implObjectData->nAmID);
             }
 
-            entity.SetObstruction(obstruction);
-            entity.SetOcclusion(occlusion);
+            // The occlusion of emitters managed by the occlusion service is computed from raycasts.
+            const bool hasOcclusion = !_occlusionService.IsEmitter(implObjectData->nAmID);
+
+            if (_updateLod.DeferObstructionOcclusion(implObjectData, obstruction, occlusion, hasOcclusion))
+            {
+                entity.SetObstruction(obstruction);
+
+                if (hasOcclusion)
+                {
+                    entity.SetOcclusion(occlusion);
+                }
+            }
 
             return EAudioRequestStatus::Success;
         }
@@ -725,15 +1240,22 @@ namespace Audio
     EAudioRequestStatus AmplitudeAudioSystem::SetListenerPosition(
         IATLListenerData* const listenerData, const SATLWorldPosition& newPosition)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::SetListenerPosition);
+        _requestRecorder.RecordSetListenerPosition(listenerData, newPosition);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (const auto* const implObjectData = dynamic_cast<SATLListenerData_Amplitude*>(listenerData))
         {
-            if (Listener listener = _engine->GetListener(implObjectData->nAmListenerObjectId); listener.Valid())
+            if (const Listener listener = _engine->GetListener(implObjectData->nAmListenerObjectId); listener.Valid())
             {
-                listener.SetLocation(ATLVec3ToAmVec3(newPosition.GetPositionVec()));
-                listener.SetOrientation(
-                    ATLVec3ToAmVec3(newPosition.GetForwardVec().GetNormalized()), ATLVec3ToAmVec3(newPosition.GetUpVec().GetNormalized()));
+                // Listener transforms are batched, and applied at the start of the next update.
+                _listeners.SetTransform(
+                    implObjectData->nAmListenerObjectId,
+                    ATLVec3ToAmVec3(newPosition.GetPositionVec()),
+                    ATLVec3ToAmVec3(newPosition.GetForwardVec().GetNormalized()),
+                    ATLVec3ToAmVec3(newPosition.GetUpVec().GetNormalized()));
 
                 result = EAudioRequestStatus::Success;
             }
@@ -750,9 +1272,12 @@ namespace Audio
         return result;
     }
 
-    EAudioRequestStatus AmplitudeAudioSystem::ResetRtpc(
-        [[maybe_unused]] IATLAudioObjectData* const audioObjectData, const IATLRtpcImplData* const rtpcData)
+    EAudioRequestStatus AmplitudeAudioSystem::ResetRtpc(IATLAudioObjectData* const audioObjectData, const IATLRtpcImplData* const rtpcData)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::ResetRtpc);
+        _requestRecorder.RecordResetRtpc(audioObjectData, rtpcData);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (const auto* const implRtpcData = dynamic_cast<const SATLRtpcImplData_Amplitude*>(rtpcData))
@@ -777,13 +1302,21 @@ namespace Audio
 
     EAudioRequestStatus AmplitudeAudioSystem::RegisterInMemoryFile(SATLAudioFileEntryInfo* const audioFileEntry)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::RegisterBank);
+        _requestRecorder.RecordRegisterBank(audioFileEntry);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (audioFileEntry)
         {
             if (auto* const implFileEntryData = dynamic_cast<SATLAudioFileEntryData_Amplitude*>(audioFileEntry->pImplData))
             {
-                if (AmBankID bankId = kAmInvalidObjectId;
+                if (audioFileEntry->bLocalized)
+                {
+                    result = BoolToARS(LoadLocalizedSoundBank(audioFileEntry, implFileEntryData));
+                }
+                else if (AmBankID bankId = kAmInvalidObjectId;
                     _engine->LoadSoundBankFromMemoryView(audioFileEntry->pFileData, aznumeric_cast<AmSize>(audioFileEntry->nSize), bankId))
                 {
                     implFileEntryData->nAmBankID = bankId;
@@ -801,18 +1334,49 @@ namespace Audio
             }
         }
 
+        if (result == EAudioRequestStatus::Success)
+        {
+            _stats.AddRegisteredBankBytes(audioFileEntry->nSize);
+        }
+
+#if !defined(AMPLITUDE_RELEASE)
+        if (result == EAudioRequestStatus::Success)
+        {
+            _residentBanks.push_back({ audioFileEntry->sFileName, audioFileEntry->nSize, audioFileEntry->bLocalized });
+        }
+#endif // !AMPLITUDE_RELEASE
+
         return result;
     }
 
     EAudioRequestStatus AmplitudeAudioSystem::UnregisterInMemoryFile(SATLAudioFileEntryInfo* const audioFileEntry)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+        _stats.CountRequest(AudioRequestType::UnregisterBank);
+        _requestRecorder.RecordUnregisterBank(audioFileEntry);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (audioFileEntry)
         {
-            if (const auto* const implFileEntryData = dynamic_cast<SATLAudioFileEntryData_Amplitude*>(audioFileEntry->pImplData))
+            if (auto* const implFileEntryData = dynamic_cast<SATLAudioFileEntryData_Amplitude*>(audioFileEntry->pImplData))
             {
-                _engine->UnloadSoundBank(implFileEntryData->nAmBankID);
+                if (_languageSwitchState != ELanguageSwitchState::Idle && implFileEntryData->pOwnedFileData != nullptr)
+                {
+                    RetireSoundBank(implFileEntryData);
+                }
+                else
+                {
+                    _engine->UnloadSoundBank(implFileEntryData->nAmBankID);
+
+                    if (implFileEntryData->pOwnedFileData != nullptr)
+                    {
+                        azfree(implFileEntryData->pOwnedFileData, Audio::AudioImplAllocator);
+                        implFileEntryData->pOwnedFileData = nullptr;
+                    }
+                }
+
+                implFileEntryData->nAmBankID = kAmInvalidObjectId;
 
                 // TODO: Always success ?
                 result = EAudioRequestStatus::Success;
@@ -823,12 +1387,29 @@ namespace Audio
             }
         }
 
+#if !defined(AMPLITUDE_RELEASE)
+        if (result == EAudioRequestStatus::Success)
+        {
+            _residentBanks.erase(
+                AZStd::remove_if(
+                    _residentBanks.begin(),
+                    _residentBanks.end(),
+                    [audioFileEntry](const SAmplitudeDebugSnapshot::SResidentBank& bank)
+                    {
+                        return bank.sFileName == audioFileEntry->sFileName;
+                    }),
+                _residentBanks.end());
+        }
+#endif // !AMPLITUDE_RELEASE
+
         return result;
     }
 
     EAudioRequestStatus AmplitudeAudioSystem::ParseAudioFileEntry(
         const AZ::rapidxml::xml_node<char>* audioFileEntryNode, SATLAudioFileEntryInfo* const fileEntryInfo)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         auto result = EAudioRequestStatus::Failure;
 
         if (audioFileEntryNode && azstricmp(audioFileEntryNode->name(), XmlTags::kFileTag) == 0 && fileEntryInfo)
@@ -876,6 +1457,12 @@ namespace Audio
 
     void AmplitudeAudioSystem::DeleteAudioFileEntryData(IATLAudioFileEntryData* const oldAudioFileEntryData)
     {
+        if (const auto* const implFileEntryData = static_cast<SATLAudioFileEntryData_Amplitude*>(oldAudioFileEntryData);
+            implFileEntryData != nullptr && implFileEntryData->pOwnedFileData != nullptr)
+        {
+            azfree(implFileEntryData->pOwnedFileData, Audio::AudioImplAllocator);
+        }
+
         azdestroy(oldAudioFileEntryData, Audio::AudioImplAllocator, SATLAudioFileEntryData_Amplitude);
     }
 
@@ -893,20 +1480,97 @@ namespace Audio
 
     IATLTriggerImplData* AmplitudeAudioSystem::NewAudioTriggerImplData(const AZ::rapidxml::xml_node<char>* audioTriggerNode)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         SATLTriggerImplData_Amplitude* newTriggerImpl = nullptr;
 
         if (audioTriggerNode && azstricmp(audioTriggerNode->name(), XmlTags::kEventTag) == 0)
         {
-            if (const auto* eventNameAttr = audioTriggerNode->first_attribute(XmlTags::kNameAttribute, 0, false))
+            AmEventID eventId = kAmInvalidObjectId;
+            float priority = DefaultTriggerPriority;
+            float coalescingWindow = 0.0f;
+            int maxInstances = DefaultTriggerMaxInstances;
+            float duration = 0.0f;
+
+            // A cached ID is only used while the loaded banks define it, otherwise the connection is parsed again.
+            if (const SAmplitudeControlCacheEntry* cachedEvent = FindCachedControl(eACCET_EVENT, audioTriggerNode);
+                cachedEvent && _engine->GetEventHandle(cachedEvent->nAmID) != nullptr)
+            {
+                eventId = cachedEvent->nAmID;
+
+                if (cachedEvent->nFlags & eACCEF_HAS_PRIORITY)
+                {
+                    priority = cachedEvent->fPriority;
+                }
+
+                if (cachedEvent->nFlags & eACCEF_HAS_COALESCING_WINDOW)
+                {
+                    coalescingWindow = cachedEvent->fCoalescingWindow;
+                }
+
+                if (cachedEvent->nFlags & eACCEF_HAS_MAX_INSTANCES)
+                {
+                    maxInstances = cachedEvent->nMaxInstances;
+                }
+
+                if (cachedEvent->nFlags & eACCEF_HAS_DURATION)
+                {
+                    duration = cachedEvent->fDuration;
+                }
+            }
+            else
             {
-                const char* eventName = eventNameAttr->value();
+                EventHandle amEvent = nullptr;
+
+                if (AmEventID connectionId; ReadConnectionId(audioTriggerNode, connectionId))
+                {
+                    amEvent = _engine->GetEventHandle(connectionId);
+                }
 
-                if (const EventHandle amEvent = _engine->GetEventHandle(eventName); amEvent != nullptr)
+                if (const auto* eventNameAttr = audioTriggerNode->first_attribute(XmlTags::kNameAttribute, 0, false);
+                    amEvent == nullptr && eventNameAttr != nullptr)
                 {
-                    newTriggerImpl = azcreate(
-                        SATLTriggerImplData_Amplitude, (amEvent->GetId()), Audio::AudioImplAllocator, "ATLTriggerImplData_Amplitude");
+                    amEvent = _engine->GetEventHandle(eventNameAttr->value());
+                }
+
+                if (amEvent != nullptr)
+                {
+                    eventId = amEvent->GetId();
+
+                    if (const auto* priorityAttr = audioTriggerNode->first_attribute(XmlTags::kPriorityAttribute, 0, false))
+                    {
+                        AZ::StringFunc::LooksLikeFloat(priorityAttr->value(), &priority);
+                    }
+
+                    if (const auto* windowAttr = audioTriggerNode->first_attribute(XmlTags::kCoalescingWindowAttribute, 0, false))
+                    {
+                        AZ::StringFunc::LooksLikeFloat(windowAttr->value(), &coalescingWindow);
+                    }
+
+                    if (const auto* maxInstancesAttr = audioTriggerNode->first_attribute(XmlTags::kMaxInstancesAttribute, 0, false))
+                    {
+                        AZ::StringFunc::LooksLikeInt(maxInstancesAttr->value(), &maxInstances);
+                    }
+
+                    if (const auto* durationAttr = audioTriggerNode->first_attribute(XmlTags::kDurationAttribute, 0, false))
+                    {
+                        AZ::StringFunc::LooksLikeFloat(durationAttr->value(), &duration);
+                    }
                 }
             }
+
+            if (eventId != kAmInvalidObjectId)
+            {
+                newTriggerImpl = azcreate(
+                    SATLTriggerImplData_Amplitude,
+                    (eventId,
+                     AZStd::max(priority, 0.0f),
+                     static_cast<AmTime>(AZStd::max(coalescingWindow, 0.0f)),
+                     static_cast<AZ::u32>(AZStd::max(maxInstances, 1)),
+                     static_cast<AmTime>(AZStd::max(duration, 0.0f))),
+                    Audio::AudioImplAllocator,
+                    "ATLTriggerImplData_Amplitude");
+            }
         }
 
         return newTriggerImpl;
@@ -919,15 +1583,34 @@ namespace Audio
 
     IATLRtpcImplData* AmplitudeAudioSystem::NewAudioRtpcImplData(const AZ::rapidxml::xml_node<char>* audioRtpcNode)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         SATLRtpcImplData_Amplitude* newRtpcImpl = nullptr;
 
         if (audioRtpcNode && azstricmp(audioRtpcNode->name(), XmlTags::kRtpcTag) == 0)
         {
-            if (const auto* eventNameAttr = audioRtpcNode->first_attribute(XmlTags::kNameAttribute, 0, false))
+            if (const SAmplitudeControlCacheEntry* cachedRtpc = FindCachedControl(eACCET_RTPC, audioRtpcNode);
+                cachedRtpc && _engine->GetRtpcHandle(cachedRtpc->nAmID) != nullptr)
             {
-                const char* eventName = eventNameAttr->value();
+                newRtpcImpl =
+                    azcreate(SATLRtpcImplData_Amplitude, (cachedRtpc->nAmID), Audio::AudioImplAllocator, "ATLRtpcImplData_Amplitude");
+            }
+            else
+            {
+                RtpcHandle amRtpc = nullptr;
+
+                if (AmRtpcID connectionId; ReadConnectionId(audioRtpcNode, connectionId))
+                {
+                    amRtpc = _engine->GetRtpcHandle(connectionId);
+                }
+
+                if (const auto* rtpcNameAttr = audioRtpcNode->first_attribute(XmlTags::kNameAttribute, 0, false);
+                    amRtpc == nullptr && rtpcNameAttr != nullptr)
+                {
+                    amRtpc = _engine->GetRtpcHandle(rtpcNameAttr->value());
+                }
 
-                if (const RtpcHandle amRtpc = _engine->GetRtpcHandle(eventName); amRtpc != nullptr)
+                if (amRtpc != nullptr)
                 {
                     newRtpcImpl =
                         azcreate(SATLRtpcImplData_Amplitude, (amRtpc->GetId()), Audio::AudioImplAllocator, "ATLRtpcImplData_Amplitude");
@@ -945,11 +1628,19 @@ namespace Audio
 
     IATLSwitchStateImplData* AmplitudeAudioSystem::NewAudioSwitchStateImplData(const AZ::rapidxml::xml_node<char>* audioSwitchStateNode)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         SATLSwitchStateImplData_Amplitude* newSwitchStateImpl = nullptr;
 
         if (audioSwitchStateNode && azstricmp(audioSwitchStateNode->name(), XmlTags::kSwitchTag) == 0)
         {
-            if (const auto* switchIdAttr = audioSwitchStateNode->first_attribute(XmlTags::kIdAttribute, 0, false); switchIdAttr)
+            if (const SAmplitudeControlCacheEntry* cachedState = FindCachedControl(eACCET_SWITCH_STATE, audioSwitchStateNode))
+            {
+                newSwitchStateImpl = azcreate(
+                    SATLSwitchStateImplData_Amplitude, (cachedState->nAmID, cachedState->nAmSecondaryID), Audio::AudioImplAllocator,
+                    "ATLSwitchStateImplData_Amplitude");
+            }
+            else if (const auto* switchIdAttr = audioSwitchStateNode->first_attribute(XmlTags::kIdAttribute, 0, false); switchIdAttr)
             {
                 if (const auto* stateNode = audioSwitchStateNode->first_node(); stateNode)
                 {
@@ -977,6 +1668,8 @@ namespace Audio
 
     IATLEnvironmentImplData* AmplitudeAudioSystem::NewAudioEnvironmentImplData(const AZ::rapidxml::xml_node<char>* audioEnvironmentNode)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
         if (audioEnvironmentNode == nullptr)
             return nullptr;
 
@@ -984,11 +1677,29 @@ namespace Audio
 
         if (azstricmp(audioEnvironmentNode->name(), XmlTags::kBusTag) == 0)
         {
-            if (const auto* auxBusNameAttr = audioEnvironmentNode->first_attribute(XmlTags::kNameAttribute, 0, false); auxBusNameAttr)
+            if (const SAmplitudeControlCacheEntry* cachedBus = FindCachedControl(eACCET_BUS, audioEnvironmentNode);
+                cachedBus && _engine->FindBus(cachedBus->nAmID).Valid())
+            {
+                newEnvironmentImpl = azcreate(
+                    SATLEnvironmentImplData_Amplitude, (eAAET_BUS, cachedBus->nAmID), Audio::AudioImplAllocator,
+                    "ATLEnvironmentImplData_Amplitude");
+            }
+            else
             {
-                const char* auxBusName = auxBusNameAttr->value();
+                Bus amBus;
+
+                if (AmBusID connectionId; ReadConnectionId(audioEnvironmentNode, connectionId))
+                {
+                    amBus = _engine->FindBus(connectionId);
+                }
+
+                if (const auto* auxBusNameAttr = audioEnvironmentNode->first_attribute(XmlTags::kNameAttribute, 0, false);
+                    !amBus.Valid() && auxBusNameAttr != nullptr)
+                {
+                    amBus = _engine->FindBus(auxBusNameAttr->value());
+                }
 
-                if (const Bus amBus = _engine->FindBus(auxBusName); amBus.Valid())
+                if (amBus.Valid())
                 {
                     newEnvironmentImpl = azcreate(
                         SATLEnvironmentImplData_Amplitude, (eAAET_BUS, amBus.GetId()), Audio::AudioImplAllocator,
@@ -998,7 +1709,13 @@ namespace Audio
         }
         else if (azstricmp(audioEnvironmentNode->name(), XmlTags::kSwitchTag) == 0)
         {
-            if (const auto* switchIdAttr = audioEnvironmentNode->first_attribute(XmlTags::kIdAttribute, 0, false); switchIdAttr)
+            if (const SAmplitudeControlCacheEntry* cachedState = FindCachedControl(eACCET_SWITCH_STATE, audioEnvironmentNode))
+            {
+                newEnvironmentImpl = azcreate(
+                    SATLEnvironmentImplData_Amplitude, (eAAET_SWITCH, cachedState->nAmID, cachedState->nAmSecondaryID),
+                    Audio::AudioImplAllocator, "ATLEnvironmentImplData_Amplitude");
+            }
+            else if (const auto* switchIdAttr = audioEnvironmentNode->first_attribute(XmlTags::kIdAttribute, 0, false); switchIdAttr)
             {
                 if (const auto* stateNode = audioEnvironmentNode->first_node(); stateNode)
                 {
@@ -1017,34 +1734,65 @@ namespace Audio
         }
         else if (azstricmp(audioEnvironmentNode->name(), XmlTags::kEnvironmentTag) == 0)
         {
-            const auto* envIdAttr = audioEnvironmentNode->first_attribute(XmlTags::kIdAttribute, 0, false);
-            const auto* valueAttr = audioEnvironmentNode->first_attribute(XmlTags::kValueAttribute, 0, false);
+            AmEnvironmentID envId = kAmInvalidObjectId;
+            AmEffectID effectId = kAmInvalidObjectId;
+            bool hasIds = false;
 
-            if (envIdAttr && valueAttr)
+            if (const SAmplitudeControlCacheEntry* cachedEnv = FindCachedControl(eACCET_ENVIRONMENT, audioEnvironmentNode))
+            {
+                envId = cachedEnv->nAmID;
+                effectId = cachedEnv->nAmSecondaryID;
+                hasIds = true;
+            }
+            else
             {
-                const char* envId = envIdAttr->value();
+                const auto* envIdAttr = audioEnvironmentNode->first_attribute(XmlTags::kIdAttribute, 0, false);
+                const auto* valueAttr = audioEnvironmentNode->first_attribute(XmlTags::kValueAttribute, 0, false);
 
-                if (Environment env = _engine->AddEnvironment(AZStd::stoull(AZStd::string(envId))); env.Valid())
+                if (envIdAttr && valueAttr)
                 {
-                    const char* effectId = valueAttr->value();
-
-                    if (const EffectHandle effect = _engine->GetEffectHandle(AZStd::stoull(AZStd::string(effectId))); effect != nullptr)
-                    {
-                        env.SetEffect(effect);
-
-                        newEnvironmentImpl = azcreate(
-                            SATLEnvironmentImplData_Amplitude, (eAAET_EFFECT, env.GetId(), effect->GetId()), Audio::AudioImplAllocator,
-                            "ATLEnvironmentImplData_Amplitude");
-                    }
+                    envId = AZStd::stoull(AZStd::string(envIdAttr->value()));
+                    effectId = AZStd::stoull(AZStd::string(valueAttr->value()));
+                    hasIds = true;
                 }
             }
+
+            // Identical environments referenced from several control files share the same engine environment.
+            if (hasIds && _environments.Acquire(_engine, envId, effectId))
+            {
+                newEnvironmentImpl = azcreate(
+                    SATLEnvironmentImplData_Amplitude, (eAAET_EFFECT, envId, effectId), Audio::AudioImplAllocator,
+                    "ATLEnvironmentImplData_Amplitude");
+            }
+        }
+
+#if !defined(AMPLITUDE_RELEASE)
+        if (newEnvironmentImpl != nullptr && newEnvironmentImpl->eType == eAAET_BUS)
+        {
+            ++_environmentBuses[newEnvironmentImpl->nAmEnvID];
         }
+#endif // !AMPLITUDE_RELEASE
 
         return newEnvironmentImpl;
     }
 
     void AmplitudeAudioSystem::DeleteAudioEnvironmentImplData(IATLEnvironmentImplData* const oldEnvironmentImplData)
     {
+        if (const auto* const implEnvironmentData = dynamic_cast<const SATLEnvironmentImplData_Amplitude*>(oldEnvironmentImplData);
+            implEnvironmentData && implEnvironmentData->eType == eAAET_EFFECT)
+        {
+            _environments.Release(_engine, implEnvironmentData->nAmEnvID, implEnvironmentData->nAmEffectID);
+        }
+#if !defined(AMPLITUDE_RELEASE)
+        else if (implEnvironmentData && implEnvironmentData->eType == eAAET_BUS)
+        {
+            if (const auto it = _environmentBuses.find(implEnvironmentData->nAmEnvID); it != _environmentBuses.end() && --it->second == 0)
+            {
+                _environmentBuses.erase(it);
+            }
+        }
+#endif // !AMPLITUDE_RELEASE
+
         azdestroy(oldEnvironmentImplData, Audio::AudioImplAllocator, SATLEnvironmentImplData_Amplitude);
     }
 
@@ -1068,6 +1816,12 @@ namespace Audio
 
     void AmplitudeAudioSystem::DeleteAudioObjectData(IATLAudioObjectData* const oldObjectData)
     {
+        if (auto* const implObjectData = dynamic_cast<SATLAudioObjectData_Amplitude*>(oldObjectData))
+        {
+            _updateLod.RemoveObject(implObjectData);
+            _spatialGrid.RemoveEntity(implObjectData->nAmID);
+        }
+
         azdestroy(oldObjectData, Audio::AudioImplAllocator, SATLAudioObjectData_Amplitude);
     }
 
@@ -1084,11 +1838,14 @@ namespace Audio
             {
                 _engine->SetDefaultListener(&listener);
                 _defaultListenerGameObjectId = newObjectData->nAmListenerObjectId;
+                _listeners.AddListener(newObjectData->nAmListenerObjectId);
             }
             else
             {
                 AZLOG_WARN("Amplitude failed in registering a default Listener.");
             }
+
+            _requestRecorder.RecordRegisterListener(newObjectData);
         }
 
         return newObjectData;
@@ -1105,6 +1862,12 @@ namespace Audio
             {
                 AZLOG_WARN("Amplitude failed in registering a Listener.");
             }
+            else
+            {
+                _listeners.AddListener(newObjectData->nAmListenerObjectId);
+            }
+
+            _requestRecorder.RecordRegisterListener(newObjectData);
         }
 
         return newObjectData;
@@ -1114,6 +1877,8 @@ namespace Audio
     {
         if (const auto* const listenerData = dynamic_cast<SATLListenerData_Amplitude*>(oldListenerData))
         {
+            _requestRecorder.RecordUnregisterListener(listenerData);
+            _listeners.RemoveListener(listenerData->nAmListenerObjectId);
             _engine->RemoveListener(listenerData->nAmListenerObjectId);
             if (listenerData->nAmListenerObjectId == _defaultListenerGameObjectId)
             {
@@ -1131,6 +1896,14 @@ namespace Audio
 
     void AmplitudeAudioSystem::DeleteAudioEventData(IATLEventData* const oldEventData)
     {
+        auto* const implEventData = dynamic_cast<SATLEventData_Amplitude*>(oldEventData);
+        _voiceLimiter.Forget(implEventData);
+
+        if (implEventData != nullptr && implEventData->nSourceId != INVALID_AUDIO_SOURCE_ID)
+        {
+            _audioInputSources.UnbindSource(implEventData->nATLID);
+        }
+
         azdestroy(oldEventData, Audio::AudioImplAllocator, SATLEventData_Amplitude);
     }
 
@@ -1138,6 +1911,13 @@ namespace Audio
     {
         if (auto* const implEventData = dynamic_cast<SATLEventData_Amplitude*>(eventData))
         {
+            _voiceLimiter.Forget(implEventData);
+
+            if (implEventData->nSourceId != INVALID_AUDIO_SOURCE_ID)
+            {
+                _audioInputSources.UnbindSource(implEventData->nATLID);
+            }
+
             implEventData->audioEventState = eAES_NONE;
             implEventData->eventCanceler = EventCanceler(nullptr);
             implEventData->nSourceId = INVALID_AUDIO_SOURCE_ID;
@@ -1149,9 +1929,24 @@ namespace Audio
         return AmplitudeImplSubPath;
     }
 
-    void AmplitudeAudioSystem::SetLanguage([[maybe_unused]] const char* const language)
+    void AmplitudeAudioSystem::SetLanguage(const char* const language)
     {
-        // TODO: Localized soundbanks not supported
+        AZ_PROFILE_FUNCTION(Audio);
+
+        if (!language || language[0] == '\0' || _language == language)
+        {
+            return;
+        }
+
+        _language = language;
+
+        // "sounds/amplitude_assets/soundbanks/<language>/"
+        m_localizedSoundbankFolder = m_soundbankFolder + _language;
+        m_localizedSoundbankFolder.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+
+        // The ATL will now unregister the localized soundbanks and register them again from the new folder. Banks of the
+        // previous language are retired instead of unloaded, and released from Update() once the new ones are ready.
+        _languageSwitchState = ELanguageSwitchState::Requested;
     }
 
     // Functions below are only used when AMPLITUDE_RELEASE is not defined
@@ -1204,70 +1999,990 @@ namespace Audio
 #endif // !AMPLITUDE_RELEASE
     }
 
-    bool AmplitudeAudioSystem::CreateAudioSource([[maybe_unused]] const SAudioInputConfig& sourceConfig)
+    bool AmplitudeAudioSystem::CreateAudioSource(const SAudioInputConfig& sourceConfig)
     {
-        CallLogFunc("Create audio source: %s", sourceConfig.m_sourceFilename.c_str());
-        return false;
+        AZ_PROFILE_FUNCTION(Audio);
+
+        return _audioInputSources.CreateSource(sourceConfig);
     }
 
-    void AmplitudeAudioSystem::DestroyAudioSource([[maybe_unused]] TAudioSourceId sourceId)
+    void AmplitudeAudioSystem::DestroyAudioSource(const TAudioSourceId sourceId)
     {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        _audioInputSources.DestroySource(sourceId);
     }
 
-    void AmplitudeAudioSystem::SetPanningMode([[maybe_unused]] PanningMode mode)
+    TAudioSourceId AmplitudeAudioSystem::CreateProceduralAudioSource(
+        const ProceduralAudioSourceConfig& sourceConfig, ProceduralAudioRenderCallback renderCallback)
     {
-        // TODO: Panning mode not supported
+        return _audioInputSources.CreateProceduralSource(sourceConfig, AZStd::move(renderCallback));
     }
 
-    void AmplitudeAudioSystem::SetBankPaths()
+    void AmplitudeAudioSystem::DestroyProceduralAudioSource(const TAudioSourceId sourceId)
     {
-        // Default...
-        // "Sounds/amplitude_assets/soundbanks/"
-        AZStd::string bankPath = kDefaultBanksPath;
-        AZ::StringFunc::AssetDatabasePath::Join(bankPath.c_str(), "", bankPath);
+        _audioInputSources.DestroySource(sourceId);
+    }
+
+    AZ::u32 AmplitudeAudioSystem::GetMixerBlockSize() const
+    {
+        if (!_engine || !_engine->IsInitialized())
+        {
+            return 0;
+        }
 
-        // "Sounds/amplitude_project/audio_config.json"
-        const AZStd::string configFile = AZStd::string(kProjectRootPath) + kEngineConfigFile;
+        // The configured buffer size is expressed in samples, for all the output channels.
+        const auto* output = _engine->GetEngineConfigDefinition()->output();
+        return output->channels() > 0 ? output->buffer_size() / output->channels() : output->buffer_size();
+    }
 
-        if (AZ::IO::FileIOBase::GetInstance() && AZ::IO::FileIOBase::GetInstance()->Exists(configFile.c_str()))
+    float AmplitudeAudioSystem::GetMixerLatencyMs() const
+    {
+        if (!_engine || !_engine->IsInitialized())
         {
-            // TODO: Support multi-platform soundbanks
-            // Audio::Wwise::ConfigurationSettings configSettings;
-            // if (configSettings.Load(configFile))
-            // {
-            //     for (const auto& platformMap : configSettings.m_platformMappings)
-            //     {
-            //         // May need to do a series of checks compare the data in the config settings to what's actually in the file system.
-            //         // This is the most straightforward platform check.
-            //         if (azstricmp(platformMap.m_enginePlatform.c_str(), AZ_TRAIT_OS_PLATFORM_NAME) == 0)
-            //         {
-            //             AZStd::string platformPath;
-            //             // "sounds/wwise/windows"
-            //             AZ::StringFunc::AssetDatabasePath::Join(bankPath.c_str(), platformMap.m_bankSubPath.c_str(), platformPath);
-
-            //             AZStd::string initBankPath;
-            //             // "sounds/wwise/windows/init.bnk"
-            //             AZ::StringFunc::AssetDatabasePath::Join(platformPath.c_str(), Audio::Wwise::InitBank, initBankPath);
-            //             if (AZ::IO::FileIOBase::GetInstance()->Exists(initBankPath.c_str()))
-            //             {
-            //                 if (!platformPath.ends_with(AZ_CORRECT_DATABASE_SEPARATOR))
-            //                 {
-            //                     platformPath.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
-            //                 }
-            //                 bankPath = AZStd::move(platformPath);
-            //                 break;
-            //             }
-            //         }
-            //     }
-            // }
+            return 0.0f;
         }
 
-        if (!bankPath.ends_with(AZ_CORRECT_DATABASE_SEPARATOR))
+        const auto* output = _engine->GetEngineConfigDefinition()->output();
+        if (output->frequency() == 0)
         {
-            bankPath.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+            return 0.0f;
         }
 
-        m_soundbankFolder = bankPath;
-        m_localizedSoundbankFolder = bankPath;
+        return 1000.0f * static_cast<float>(GetMixerBlockSize()) / static_cast<float>(output->frequency());
+    }
+
+    void AmplitudeAudioSystem::SetPanningMode(const PanningMode mode)
+    {
+        AZStd::scoped_lock lock(_panningMutex);
+        _pendingPanningMode = mode;
+    }
+
+    void AmplitudeAudioSystem::SetPanningTier(const PanningMode mode, const PanningTier tier)
+    {
+        AZStd::scoped_lock lock(_panningMutex);
+
+        if (mode == PanningMode::Headphones)
+        {
+            _pendingHeadphonesPanningTier = tier;
+        }
+        else
+        {
+            _pendingSpeakersPanningTier = tier;
+        }
+    }
+
+    void AmplitudeAudioSystem::RunPendingPanningChanges()
+    {
+        PanningTier previousTier;
+        PanningTier currentTier;
+
+        {
+            AZStd::scoped_lock lock(_panningMutex);
+
+            if (!_pendingPanningMode && !_pendingSpeakersPanningTier && !_pendingHeadphonesPanningTier)
+            {
+                return;
+            }
+
+            previousTier = _panningMode == PanningMode::Headphones ? _headphonesPanningTier : _speakersPanningTier;
+
+            // Only the last change of each value since the previous update is applied.
+            _panningMode = _pendingPanningMode.value_or(_panningMode);
+            _speakersPanningTier = _pendingSpeakersPanningTier.value_or(_speakersPanningTier);
+            _headphonesPanningTier = _pendingHeadphonesPanningTier.value_or(_headphonesPanningTier);
+
+            _pendingPanningMode.reset();
+            _pendingSpeakersPanningTier.reset();
+            _pendingHeadphonesPanningTier.reset();
+
+            currentTier = _panningMode == PanningMode::Headphones ? _headphonesPanningTier : _speakersPanningTier;
+        }
+
+        if (currentTier != previousTier)
+        {
+            ApplyPanningTier();
+        }
+    }
+
+    AZStd::vector<AZ::u32> AmplitudeAudioSystem::GetUpdateLodBandCounts() const
+    {
+        AZStd::vector<AZ::u32> counts(_updateLod.GetBandCount());
+
+        for (size_t i = 0; i < counts.size(); ++i)
+        {
+            counts[i] = _updateLod.GetBandObjectCount(i);
+        }
+
+        return counts;
+    }
+
+    AZStd::vector<ListenerVoiceCount> AmplitudeAudioSystem::GetListenerVoiceCounts() const
+    {
+        return _listeners.GetVoiceCounts();
+    }
+
+    AudioFrameStats AmplitudeAudioSystem::GetAudioFrameStats() const
+    {
+        return _stats.GetLastFrame();
+    }
+
+    void AmplitudeAudioSystem::SetAudioZone(const AZ::u64 zoneId, const AZ::Aabb& bounds)
+    {
+        _spatialGrid.SetZone(zoneId, ATLVec3ToAmVec3(bounds.GetMin()), ATLVec3ToAmVec3(bounds.GetMax()));
+    }
+
+    void AmplitudeAudioSystem::RemoveAudioZone(const AZ::u64 zoneId)
+    {
+        _spatialGrid.RemoveZone(zoneId);
+    }
+
+    AZStd::vector<AZStd::vector<TAudioObjectID>> AmplitudeAudioSystem::QueryAudioObjects(
+        const AZStd::vector<AudioObjectQuery>& queries) const
+    {
+        AZStd::vector<AmplitudeSpatialGrid::SQuery> gridQueries;
+        gridQueries.reserve(queries.size());
+
+        for (const auto& query : queries)
+        {
+            AmplitudeSpatialGrid::SQuery& gridQuery = gridQueries.emplace_back();
+            gridQuery.fRadius = query.m_radius;
+            gridQuery.nZoneID = query.m_zoneId;
+
+            switch (query.m_type)
+            {
+            case AudioObjectQuery::Type::Radius:
+                gridQuery.eType = AmplitudeSpatialGrid::eSQT_RADIUS;
+                gridQuery.vMin = ATLVec3ToAmVec3(query.m_center);
+                gridQuery.vMax = gridQuery.vMin;
+                break;
+            case AudioObjectQuery::Type::Box:
+                gridQuery.eType = AmplitudeSpatialGrid::eSQT_BOX;
+                gridQuery.vMin = ATLVec3ToAmVec3(query.m_bounds.GetMin());
+                gridQuery.vMax = ATLVec3ToAmVec3(query.m_bounds.GetMax());
+                break;
+            case AudioObjectQuery::Type::Zone:
+                gridQuery.eType = AmplitudeSpatialGrid::eSQT_ZONE;
+                break;
+            }
+        }
+
+        AZStd::vector<AmplitudeSpatialGrid::TEntityVector> gridResults;
+        _spatialGrid.Query(gridQueries, gridResults);
+
+        AZStd::vector<AZStd::vector<TAudioObjectID>> results(gridResults.size());
+        for (size_t i = 0; i < gridResults.size(); ++i)
+        {
+            results[i].assign(gridResults[i].begin(), gridResults[i].end());
+        }
+
+        return results;
+    }
+
+    PanningTier AmplitudeAudioSystem::GetPanningTier() const
+    {
+        AZStd::scoped_lock lock(_panningMutex);
+        return _panningMode == PanningMode::Headphones ? _headphonesPanningTier : _speakersPanningTier;
+    }
+
+    void AmplitudeAudioSystem::ApplyPanningTier()
+    {
+        // Applied again once the engine is initialized.
+        if (!_engine->IsInitialized())
+        {
+            return;
+        }
+
+        _appliedPanningTier = GetPanningTier();
+
+        SparkyStudios::Audio::Amplitude::PanningMode amPanningMode;
+
+        switch (_appliedPanningTier)
+        {
+        case PanningTier::BinauralLow:
+            amPanningMode = SparkyStudios::Audio::Amplitude::PanningMode_BinauralLowQuality;
+            break;
+        case PanningTier::BinauralMedium:
+            amPanningMode = SparkyStudios::Audio::Amplitude::PanningMode_BinauralMediumQuality;
+            break;
+        case PanningTier::BinauralHigh:
+            amPanningMode = SparkyStudios::Audio::Amplitude::PanningMode_BinauralHighQuality;
+            break;
+        case PanningTier::Stereo:
+            [[fallthrough]];
+        default:
+            amPanningMode = SparkyStudios::Audio::Amplitude::PanningMode_Stereo;
+            break;
+        }
+
+        // The mixer picks the new mode up on its next block, playing voices are not restarted.
+        _engine->SetPanningMode(amPanningMode);
+
+        AZLOG_INFO("[Amplitude] Using the %s panning tier.", kPanningTierNames[static_cast<size_t>(_appliedPanningTier)]);
+    }
+
+    void AmplitudeAudioSystem::LoadControlCache(const char* folderPath)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        _controlCache.Clear();
+
+        if (const size_t fileCount = _controlCache.LoadFolder(folderPath); fileCount > 0)
+        {
+            AZLOG_INFO(
+                "[Amplitude] Loaded %zu control cache files with %zu connections.", fileCount, _controlCache.GetEntryCount());
+        }
+    }
+
+    const SAmplitudeControlCacheEntry* AmplitudeAudioSystem::FindCachedControl(
+        const EAmplitudeControlCacheEntryType type, const AZ::rapidxml::xml_node<char>* node) const
+    {
+        // Without any cache file, don't pay for hashing the node.
+        return _controlCache.IsEmpty() ? nullptr : _controlCache.Find(type, AmplitudeControlCache::MakeKey(node));
+    }
+
+    void AmplitudeAudioSystem::LoadRuntimeSettings()
+    {
+        const AZStd::string configFile = AZStd::string(kAssetsRootPath) + kRuntimeSettingsFile;
+
+        rapidjson::Document configDoc;
+        if (!ReadJsonFile(configFile, configDoc) || !configDoc.IsObject())
+        {
+            return;
+        }
+
+        if (configDoc.HasMember(kVoiceLimiterKey) && configDoc[kVoiceLimiterKey].IsObject())
+        {
+            const auto& settings = configDoc[kVoiceLimiterKey];
+
+            if (settings.HasMember(kMaxRealVoicesKey) && settings[kMaxRealVoicesKey].IsUint())
+            {
+                _voiceLimiter.SetMaxRealVoices(settings[kMaxRealVoicesKey].GetUint());
+            }
+
+            if (settings.HasMember(kMaxVirtualTimeKey) && settings[kMaxVirtualTimeKey].IsNumber())
+            {
+                _voiceLimiter.SetMaxVirtualTime(settings[kMaxVirtualTimeKey].GetDouble());
+            }
+
+            if (settings.HasMember(kDistanceReferenceKey) && settings[kDistanceReferenceKey].IsNumber())
+            {
+                _voiceLimiter.SetDistanceReference(settings[kDistanceReferenceKey].GetFloat());
+            }
+        }
+
+        if (configDoc.HasMember(kUpdateLodKey) && configDoc[kUpdateLodKey].IsObject())
+        {
+            const auto& settings = configDoc[kUpdateLodKey];
+
+            if (settings.HasMember(kBandsKey) && settings[kBandsKey].IsArray())
+            {
+                AZStd::vector<AmplitudeUpdateLod::SBand> bands;
+
+                for (const auto& band : settings[kBandsKey].GetArray())
+                {
+                    if (!band.IsObject() || !band.HasMember(kMaxDistanceKey) || !band[kMaxDistanceKey].IsNumber() ||
+                        !band.HasMember(kIntervalKey) || !band[kIntervalKey].IsUint())
+                    {
+                        AZLOG_WARN("[Amplitude] Skipping an invalid update LOD band in %s.", kRuntimeSettingsFile);
+                        continue;
+                    }
+
+                    bands.push_back({ band[kMaxDistanceKey].GetFloat(), band[kIntervalKey].GetUint() });
+                }
+
+                if (!bands.empty())
+                {
+                    _updateLod.SetBands(bands);
+                }
+            }
+        }
+
+        if (configDoc.HasMember(kSpatialGridKey) && configDoc[kSpatialGridKey].IsObject())
+        {
+            const auto& settings = configDoc[kSpatialGridKey];
+
+            if (settings.HasMember(kCellSizeKey) && settings[kCellSizeKey].IsNumber())
+            {
+                _spatialGrid.SetCellSize(settings[kCellSizeKey].GetFloat());
+            }
+        }
+
+        if (configDoc.HasMember(kBusGainsKey) && configDoc[kBusGainsKey].IsObject())
+        {
+            const auto& settings = configDoc[kBusGainsKey];
+
+            if (settings.HasMember(kRampTimeKey) && settings[kRampTimeKey].IsNumber())
+            {
+                _sendRamps.SetRampTime(settings[kRampTimeKey].GetDouble());
+            }
+        }
+
+        if (configDoc.HasMember(kTelemetryKey) && configDoc[kTelemetryKey].IsObject())
+        {
+            const auto& settings = configDoc[kTelemetryKey];
+
+            if (settings.HasMember(kFormatKey) && settings[kFormatKey].IsString())
+            {
+                const bool isJson = azstricmp(settings[kFormatKey].GetString(), "json") == 0;
+                _telemetry.SetFormat(isJson ? AmplitudeTelemetryRecorder::eTF_JSON : AmplitudeTelemetryRecorder::eTF_CSV);
+            }
+
+            if (settings.HasMember(kPathKey) && settings[kPathKey].IsString())
+            {
+                _telemetry.SetPath(settings[kPathKey].GetString());
+            }
+
+            if (settings.HasMember(kMaxFileSizeKey) && settings[kMaxFileSizeKey].IsUint64())
+            {
+                _telemetry.SetMaxFileSize(settings[kMaxFileSizeKey].GetUint64());
+            }
+
+            if (settings.HasMember(kMaxFilesKey) && settings[kMaxFilesKey].IsUint())
+            {
+                _telemetry.SetMaxFileCount(settings[kMaxFilesKey].GetUint());
+            }
+
+            if (settings.HasMember(kEnabledKey) && settings[kEnabledKey].IsBool())
+            {
+                amp_telemetry = settings[kEnabledKey].GetBool();
+            }
+        }
+
+        if (configDoc.HasMember(kPanningKey) && configDoc[kPanningKey].IsObject())
+        {
+            const auto& settings = configDoc[kPanningKey];
+            AZStd::scoped_lock lock(_panningMutex);
+
+            if (settings.HasMember(kSpeakersKey) && settings[kSpeakersKey].IsString())
+            {
+                ParsePanningTier(settings[kSpeakersKey].GetString(), _speakersPanningTier);
+            }
+
+            if (settings.HasMember(kHeadphonesKey) && settings[kHeadphonesKey].IsString())
+            {
+                ParsePanningTier(settings[kHeadphonesKey].GetString(), _headphonesPanningTier);
+            }
+        }
+
+        if (configDoc.HasMember(kOcclusionKey) && configDoc[kOcclusionKey].IsObject())
+        {
+            const auto& settings = configDoc[kOcclusionKey];
+
+            if (settings.HasMember(kEnabledKey) && settings[kEnabledKey].IsBool())
+            {
+                _occlusionService.SetEnabled(settings[kEnabledKey].GetBool());
+            }
+
+            if (settings.HasMember(kRaysPerFrameKey) && settings[kRaysPerFrameKey].IsUint())
+            {
+                _occlusionService.SetRaysPerFrame(settings[kRaysPerFrameKey].GetUint());
+            }
+
+            if (settings.HasMember(kSmoothingTimeKey) && settings[kSmoothingTimeKey].IsNumber())
+            {
+                _occlusionService.SetSmoothingTime(settings[kSmoothingTimeKey].GetDouble());
+            }
+
+            if (settings.HasMember(kMaxDistanceKey) && settings[kMaxDistanceKey].IsNumber())
+            {
+                _occlusionService.SetMaxDistance(settings[kMaxDistanceKey].GetFloat());
+            }
+        }
+    }
+
+    void AmplitudeAudioSystem::SetOcclusionEmitterEnabled(const TAudioObjectID audioObjectId, const bool enabled)
+    {
+        _occlusionService.SetEmitterEnabled(static_cast<AmEntityID>(audioObjectId), enabled);
+    }
+
+    void AmplitudeAudioSystem::SetBankPaths()
+    {
+        // Default...
+        // "Sounds/amplitude_assets/soundbanks/"
+        AZStd::string bankPath = kDefaultBanksPath;
+        AZ::StringFunc::AssetDatabasePath::Join(bankPath.c_str(), "", bankPath);
+
+        // "Sounds/amplitude_assets/runtime_settings.json"
+        const AZStd::string configFile = AZStd::string(kAssetsRootPath) + kRuntimeSettingsFile;
+
+        if (AZ::IO::FileIOBase::GetInstance() && AZ::IO::FileIOBase::GetInstance()->Exists(configFile.c_str()))
+        {
+            rapidjson::Document configDoc;
+            if (ReadJsonFile(configFile, configDoc) && configDoc.IsObject() && configDoc.HasMember(kPlatformMappingsKey) &&
+                configDoc[kPlatformMappingsKey].IsArray())
+            {
+                for (const auto& platformMap : configDoc[kPlatformMappingsKey].GetArray())
+                {
+                    if (!platformMap.IsObject() || !platformMap.HasMember(kBankSubPathKey) || !platformMap[kBankSubPathKey].IsString())
+                    {
+                        continue;
+                    }
+
+                    // A mapping can target an asset platform (e.g. "linux"), or an OS platform (e.g. "Linux"). Asset platforms
+                    // allow the same OS to ship lighter variants of the soundbanks.
+                    const bool matchesAssetPlatform = platformMap.HasMember(kAssetPlatformKey) &&
+                        platformMap[kAssetPlatformKey].IsString() &&
+                        azstricmp(platformMap[kAssetPlatformKey].GetString(), m_assetsPlatform.c_str()) == 0;
+                    const bool matchesEnginePlatform = platformMap.HasMember(kEnginePlatformKey) &&
+                        platformMap[kEnginePlatformKey].IsString() &&
+                        azstricmp(platformMap[kEnginePlatformKey].GetString(), AZ_TRAIT_OS_PLATFORM_NAME) == 0;
+
+                    if (!matchesAssetPlatform && !matchesEnginePlatform)
+                    {
+                        continue;
+                    }
+
+                    AZStd::string platformPath;
+                    // "sounds/amplitude_assets/soundbanks/linux_low"
+                    AZ::StringFunc::AssetDatabasePath::Join(bankPath.c_str(), platformMap[kBankSubPathKey].GetString(), platformPath);
+
+                    if (AZ::IO::FileIOBase::GetInstance()->IsDirectory(platformPath.c_str()))
+                    {
+                        bankPath = AZStd::move(platformPath);
+                        break;
+                    }
+
+                    AZLOG_WARN("[Amplitude] Soundbank platform mapping ignored, the folder '%s' does not exist.", platformPath.c_str());
+                }
+            }
+        }
+
+        if (!bankPath.ends_with(AZ_CORRECT_DATABASE_SEPARATOR))
+        {
+            bankPath.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        }
+
+        m_soundbankFolder = bankPath;
+        m_localizedSoundbankFolder = bankPath;
+
+        if (!_language.empty())
+        {
+            m_localizedSoundbankFolder += _language;
+            m_localizedSoundbankFolder.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        }
+    }
+
+    void AmplitudeAudioSystem::UpdateLanguageSwitch()
+    {
+        switch (_languageSwitchState)
+        {
+        case ELanguageSwitchState::Requested:
+            {
+                if (_retiredSoundBanks.empty())
+                {
+                    // Nothing was loaded for the previous language, there is nothing to swap.
+                    _languageSwitchState = ELanguageSwitchState::Idle;
+                    break;
+                }
+
+                // Sound files of the new banks are loaded in the background, the old banks keep playing meanwhile.
+                _engine->StartLoadSoundFiles();
+                _languageSwitchState = ELanguageSwitchState::Loading;
+                break;
+            }
+        case ELanguageSwitchState::Loading:
+            {
+                if (_engine->TryFinalizeLoadSoundFiles())
+                {
+                    ReleaseRetiredSoundBanks();
+                    _languageSwitchState = ELanguageSwitchState::Idle;
+                }
+                break;
+            }
+        default:
+            break;
+        }
+    }
+
+    bool AmplitudeAudioSystem::LoadLocalizedSoundBank(
+        SATLAudioFileEntryInfo* const audioFileEntry, SATLAudioFileEntryData_Amplitude* const implFileEntryData)
+    {
+        // The ATL frees the file data of the entry once it is unregistered, but a retired bank must stay readable until the
+        // new language has finished loading. Localized banks are then loaded from a copy owned by the implementation.
+        const auto fileSize = aznumeric_cast<AmSize>(audioFileEntry->nSize);
+
+        void* fileData = azmalloc(fileSize, AM_SIMD_ALIGNMENT, Audio::AudioImplAllocator, "ATLAudioFileEntryData_Amplitude-Localized");
+        if (fileData == nullptr)
+        {
+            implFileEntryData->nAmBankID = kAmInvalidObjectId;
+            AZLOG_ERROR("[Amplitude] Not enough memory to load the localized soundbank '%s'.", audioFileEntry->sFileName);
+            return false;
+        }
+
+        memcpy(fileData, audioFileEntry->pFileData, fileSize);
+
+        AmBankID bankId = kAmInvalidObjectId;
+        if (!_engine->LoadSoundBankFromMemoryView(fileData, fileSize, bankId))
+        {
+            azfree(fileData, Audio::AudioImplAllocator);
+            implFileEntryData->nAmBankID = kAmInvalidObjectId;
+            AZLOG_ERROR("Amplitude failed to load localized soundbank '%s'\n", audioFileEntry->sFileName);
+            return false;
+        }
+
+        // When both languages share the same bank ID, the load only added a reference to the retired bank, and the
+        // new language was not loaded. Unload the retired bank first, there is no overlap between the two languages.
+        if (const auto it = AZStd::find_if(
+                _retiredSoundBanks.begin(),
+                _retiredSoundBanks.end(),
+                [bankId](const SRetiredSoundBank& retiredBank)
+                {
+                    return retiredBank.nAmBankID == bankId;
+                });
+            it != _retiredSoundBanks.end())
+        {
+            AZLOG_WARN(
+                "[Amplitude] The localized soundbank '%s' has the same ID in both languages, it is reloaded without overlap.",
+                audioFileEntry->sFileName);
+
+            _engine->UnloadSoundBank(bankId);
+            _engine->UnloadSoundBank(it->nAmBankID);
+            azfree(it->pOwnedFileData, Audio::AudioImplAllocator);
+            _retiredSoundBanks.erase(it);
+
+            if (!_engine->LoadSoundBankFromMemoryView(fileData, fileSize, bankId))
+            {
+                azfree(fileData, Audio::AudioImplAllocator);
+                implFileEntryData->nAmBankID = kAmInvalidObjectId;
+                AZLOG_ERROR("Amplitude failed to load localized soundbank '%s'\n", audioFileEntry->sFileName);
+                return false;
+            }
+        }
+
+        implFileEntryData->nAmBankID = bankId;
+        implFileEntryData->pOwnedFileData = fileData;
+        return true;
+    }
+
+    void AmplitudeAudioSystem::RetireSoundBank(SATLAudioFileEntryData_Amplitude* const implFileEntryData)
+    {
+        // Keep the previous language loaded, and playing, until the new one has finished loading. The retired bank
+        // takes over the file data the engine reads from, and frees it once unloaded.
+        _retiredSoundBanks.push_back({ implFileEntryData->nAmBankID, implFileEntryData->pOwnedFileData });
+        implFileEntryData->pOwnedFileData = nullptr;
+    }
+
+    void AmplitudeAudioSystem::RecordTelemetry()
+    {
+        // Recording is started and stopped from the audio thread, so the writer never races with Record().
+        if (const bool isEnabled = amp_telemetry; isEnabled != _telemetry.IsRunning())
+        {
+            if (!isEnabled)
+            {
+                _telemetry.Stop();
+            }
+            else
+            {
+                AZStd::vector<AZStd::string> memoryPoolNames;
+
+#if !defined(AMPLITUDE_RELEASE)
+                for (size_t memId = 0; memId < AM_MEM_POOLS_COUNT; ++memId)
+                {
+                    memoryPoolNames.emplace_back(gMemoryManagerPools[memId]);
+                }
+#endif // !AMPLITUDE_RELEASE
+
+                if (!_telemetry.Start(memoryPoolNames))
+                {
+                    amp_telemetry = false;
+                }
+            }
+        }
+
+        if (!_telemetry.IsRunning())
+        {
+            return;
+        }
+
+        AmplitudeTelemetryRecorder::SSample sample{};
+        sample.sFrameStats = _stats.GetLastFrame();
+
+#if !defined(AMPLITUDE_RELEASE)
+        for (size_t memId = 0; memId < AM_MEM_POOLS_COUNT; ++memId)
+        {
+            sample.cMemoryUsed[memId] = amMemory->GetStats(static_cast<MemoryPoolKind>(memId)).maxMemoryUsed.load();
+        }
+#endif // !AMPLITUDE_RELEASE
+
+        _telemetry.Record(sample);
+    }
+
+    void AmplitudeAudioSystem::RequestOfflineRender(const AZStd::string& timelinePath, const AZStd::string& outputPath)
+    {
+        AZStd::scoped_lock lock(_offlineRenderMutex);
+        _pendingOfflineRenders.emplace_back(timelinePath, outputPath);
+    }
+
+    void AmplitudeAudioSystem::RunPendingOfflineRenders()
+    {
+        AZStd::vector<AZStd::pair<AZStd::string, AZStd::string>> renders;
+
+        {
+            AZStd::scoped_lock lock(_offlineRenderMutex);
+            renders.swap(_pendingOfflineRenders);
+        }
+
+        for (const auto& render : renders)
+        {
+            RenderOffline(render.first, render.second);
+        }
+    }
+
+    bool AmplitudeAudioSystem::RenderOffline(const AZStd::string& timelinePath, const AZStd::string& outputPath)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        // Keeps the objects of the timeline away from the IDs given by the ATL.
+        static constexpr TAudioObjectID kOfflineRenderObjectIdBase = TAudioObjectID(1) << 62;
+
+        if (!_nullDriver.IsOpen())
+        {
+            AZLOG_ERROR(
+                "[Amplitude] Offline rendering requires the \"%s\" driver in the engine configuration.", AmplitudeNullDriver::DriverName);
+            return false;
+        }
+
+        // The mixer would render the voices of the game along with the timeline.
+        if (const AZ::u32 voiceCount = _voiceLimiter.GetRealVoiceCount() + _voiceLimiter.GetVirtualVoiceCount(); voiceCount > 0)
+        {
+            AZLOG_ERROR("[Amplitude] Unable to render offline while %u voices are playing, stop all the events first.", voiceCount);
+            return false;
+        }
+
+        rapidjson::Document timelineDoc;
+        AmplitudeOfflineTimeline timeline;
+        if (!ReadJsonFile(timelinePath, timelineDoc) || !timeline.Load(timelineDoc))
+        {
+            AZLOG_ERROR("[Amplitude] Unable to load the offline render timeline '%s'.", timelinePath.c_str());
+            return false;
+        }
+
+        const AZ::u32 sampleRate = _nullDriver.GetSampleRate();
+        const AZ::u32 blockFrameCount = _nullDriver.GetBlockFrameCount();
+        if (sampleRate == 0 || blockFrameCount == 0)
+        {
+            AZLOG_ERROR("[Amplitude] The null driver has no valid output format, unable to render offline.");
+            return false;
+        }
+
+        AmplitudeWavWriter writer;
+        const auto bitsPerSample = static_cast<AZ::u16>(_nullDriver.GetBytesPerSample() * 8);
+        if (!writer.Open(outputPath, sampleRate, _nullDriver.GetChannelCount(), bitsPerSample, _nullDriver.IsFloatOutput()))
+        {
+            return false;
+        }
+
+        AZStd::unordered_map<AZ::u64, SATLAudioObjectData_Amplitude*> objects;
+        AZStd::vector<AZStd::pair<SATLAudioObjectData_Amplitude*, SATLEventData_Amplitude*>> events;
+
+        const auto stopEvents = [this, &events](const SATLAudioObjectData_Amplitude* const objectData)
+        {
+            for (const auto& event : events)
+            {
+                if ((objectData == nullptr || event.first == objectData) && event.second->audioEventState == eAES_PLAYING)
+                {
+                    StopEvent(event.first, event.second);
+                }
+            }
+        };
+
+        const auto getObject = [this, &objects](const AZ::u64 entityId)
+        {
+            auto it = objects.find(entityId);
+            if (it == objects.end())
+            {
+                SATLAudioObjectData_Amplitude* objectData = NewAudioObjectData(kOfflineRenderObjectIdBase + entityId);
+                RegisterAudioObject(objectData, nullptr);
+                it = objects.emplace(entityId, objectData).first;
+            }
+
+            return it->second;
+        };
+
+        // The mixer thread of the null driver is paused, each block is mixed right after its engine update.
+        _nullDriver.SetOffline(true);
+
+        const AZ::u64 blockCount =
+            static_cast<AZ::u64>(AZStd::ceil(timeline.GetDuration() * static_cast<double>(sampleRate) / blockFrameCount));
+        const float blockDurationMs = 1000.0f * static_cast<float>(blockFrameCount) / static_cast<float>(sampleRate);
+
+        const auto& entries = timeline.GetEntries();
+        size_t nextEntry = 0;
+
+        const auto renderStart = AZStd::chrono::steady_clock::now();
+
+        for (AZ::u64 block = 0; block < blockCount; ++block)
+        {
+            const double blockTime = static_cast<double>(block * blockFrameCount) / static_cast<double>(sampleRate);
+
+            for (; nextEntry < entries.size() && entries[nextEntry].fTime <= blockTime; ++nextEntry)
+            {
+                const AmplitudeOfflineTimeline::SEntry& entry = entries[nextEntry];
+                SATLAudioObjectData_Amplitude* const objectData = getObject(entry.nEntityID);
+
+                switch (entry.eType)
+                {
+                case AmplitudeOfflineTimeline::eOTE_TRIGGER:
+                    {
+                        const EventHandle event = _engine->GetEventHandle(entry.sName);
+                        if (event == nullptr)
+                        {
+                            AZLOG_WARN("[Amplitude] Offline render: the event '%s' is not in the loaded banks.", entry.sName.c_str());
+                            break;
+                        }
+
+                        // No coalescing, the timeline plays exactly what it lists.
+                        const SATLTriggerImplData_Amplitude triggerData(event->GetId(), DefaultTriggerPriority, 0.0, 0, 0.0);
+                        SATLEventData_Amplitude* const eventData = NewAudioEventData(static_cast<TAudioEventID>(events.size() + 1));
+                        events.emplace_back(objectData, eventData);
+                        ActivateTrigger(objectData, &triggerData, eventData, nullptr);
+                        break;
+                    }
+                case AmplitudeOfflineTimeline::eOTE_STOP:
+                    {
+                        stopEvents(objectData);
+                        break;
+                    }
+                case AmplitudeOfflineTimeline::eOTE_POSITION:
+                    {
+                        const SATLWorldPosition position(AZ::Vector3(entry.vPosition.X, entry.vPosition.Y, entry.vPosition.Z));
+                        SetPosition(objectData, position);
+                        break;
+                    }
+                case AmplitudeOfflineTimeline::eOTE_RTPC:
+                    {
+                        const RtpcHandle rtpc = _engine->GetRtpcHandle(entry.sName);
+                        if (rtpc == nullptr)
+                        {
+                            AZLOG_WARN("[Amplitude] Offline render: the RTPC '%s' is not in the loaded banks.", entry.sName.c_str());
+                            break;
+                        }
+
+                        const SATLRtpcImplData_Amplitude rtpcData(rtpc->GetId());
+                        SetRtpc(objectData, &rtpcData, entry.fValue);
+                        break;
+                    }
+                }
+            }
+
+            UpdateFrame(blockDurationMs);
+            writer.Write(_nullDriver.MixBlock(), _nullDriver.GetBlockByteSize());
+        }
+
+        const AZStd::chrono::duration<double> renderTime = AZStd::chrono::steady_clock::now() - renderStart;
+
+        // Events are stopped before being deleted, the voice limiter may still reference them.
+        stopEvents(nullptr);
+
+        for (const auto& event : events)
+        {
+            DeleteAudioEventData(event.second);
+        }
+
+        for (const auto& object : objects)
+        {
+            UnregisterAudioObject(object.second);
+            DeleteAudioObjectData(object.second);
+        }
+
+        _nullDriver.SetOffline(false);
+        writer.Close();
+
+        const double renderedTime = static_cast<double>(blockCount * blockFrameCount) / static_cast<double>(sampleRate);
+        AZLOG_INFO(
+            "[Amplitude] Rendered %.2f s of audio to '%s' in %.2f s (%.1fx realtime).", renderedTime, outputPath.c_str(),
+            renderTime.count(), renderTime.count() > 0.0 ? renderedTime / renderTime.count() : 0.0);
+
+        return true;
+    }
+
+    void AmplitudeAudioSystem::StartRequestCapture(const AZStd::string& tracePath)
+    {
+        AZStd::scoped_lock lock(_requestTraceMutex);
+        _pendingRequestTraceCommands.push_back({ SRequestTraceCommand::eRTC_START_CAPTURE, tracePath, 0.0f });
+    }
+
+    void AmplitudeAudioSystem::StopRequestCapture()
+    {
+        AZStd::scoped_lock lock(_requestTraceMutex);
+        _pendingRequestTraceCommands.push_back({ SRequestTraceCommand::eRTC_STOP_CAPTURE, {}, 0.0f });
+    }
+
+    void AmplitudeAudioSystem::ReplayRequestCapture(const AZStd::string& tracePath, const float speed)
+    {
+        AZStd::scoped_lock lock(_requestTraceMutex);
+        _pendingRequestTraceCommands.push_back({ SRequestTraceCommand::eRTC_REPLAY, tracePath, speed });
+    }
+
+    void AmplitudeAudioSystem::RunPendingRequestTraceCommands()
+    {
+        AZStd::vector<SRequestTraceCommand> commands;
+
+        {
+            AZStd::scoped_lock lock(_requestTraceMutex);
+            commands.swap(_pendingRequestTraceCommands);
+        }
+
+        for (const SRequestTraceCommand& command : commands)
+        {
+            switch (command.eType)
+            {
+            case SRequestTraceCommand::eRTC_START_CAPTURE:
+                {
+                    if (_requestRecorder.Open(command.sPath))
+                    {
+                        AZLOG_INFO("[Amplitude] Capturing the audio requests to '%s'.", command.sPath.c_str());
+                    }
+                    break;
+                }
+            case SRequestTraceCommand::eRTC_STOP_CAPTURE:
+                {
+                    if (_requestRecorder.IsOpen())
+                    {
+                        _requestRecorder.Close();
+                        AZLOG_INFO("[Amplitude] Request capture stopped, %llu requests recorded.", _requestRecorder.GetRequestCount());
+                    }
+                    break;
+                }
+            case SRequestTraceCommand::eRTC_REPLAY:
+                {
+                    if (!_requestReplayer.Start(command.sPath, command.fSpeed))
+                    {
+                        break;
+                    }
+
+                    AZLOG_INFO("[Amplitude] Replaying the request trace '%s'.", command.sPath.c_str());
+
+                    if (!_requestReplayer.IsPaced())
+                    {
+                        ReplayRequestsUnpaced();
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    void AmplitudeAudioSystem::ReplayRequestsUnpaced()
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        // With the null driver, the mixer is driven by the replay so that its cost is part of the profile.
+        const bool mixesBlocks = _nullDriver.IsOpen() && _nullDriver.GetBlockFrameCount() > 0;
+        const double framesPerMs = static_cast<double>(_nullDriver.GetSampleRate()) / 1000.0;
+        const auto blockFrameCount = static_cast<double>(_nullDriver.GetBlockFrameCount());
+        double pendingFrames = 0.0;
+        double replayedTimeMs = 0.0;
+
+        if (mixesBlocks)
+        {
+            _nullDriver.SetOffline(true);
+        }
+
+        const auto replayStart = AZStd::chrono::steady_clock::now();
+
+        _requestReplayer.Run(
+            this,
+            [&](const float updateIntervalMs)
+            {
+                UpdateFrame(updateIntervalMs);
+                replayedTimeMs += updateIntervalMs;
+
+                if (!mixesBlocks)
+                {
+                    return;
+                }
+
+                pendingFrames += updateIntervalMs * framesPerMs;
+
+                while (pendingFrames >= blockFrameCount)
+                {
+                    _nullDriver.MixBlock();
+                    pendingFrames -= blockFrameCount;
+                }
+            });
+
+        const AZStd::chrono::duration<double, AZStd::milli> replayTime = AZStd::chrono::steady_clock::now() - replayStart;
+
+        if (mixesBlocks)
+        {
+            _nullDriver.SetOffline(false);
+        }
+
+        AZLOG_INFO(
+            "[Amplitude] Request trace replayed, %llu requests and %.2f s of updates in %.2f s (%.1fx realtime).",
+            _requestReplayer.GetRequestCount(), replayedTimeMs / 1000.0, replayTime.count() / 1000.0,
+            replayTime.count() > 0.0 ? replayedTimeMs / replayTime.count() : 0.0);
+
+        _requestReplayer.Stop(this);
+    }
+
+#if !defined(AMPLITUDE_RELEASE)
+    void AmplitudeAudioSystem::PublishDebugSnapshot(const float updateIntervalMs)
+    {
+        // Number of events listed by the overlay, and interval between two snapshots.
+        static constexpr size_t kDebugTopEventCount = 8;
+        static constexpr float kDebugSnapshotIntervalMs = 100.0f;
+
+        if (!amp_debugOverlay)
+        {
+            return;
+        }
+
+        _debugSnapshotElapsedMs += updateIntervalMs;
+        if (_debugSnapshotElapsedMs < kDebugSnapshotIntervalMs)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Audio);
+
+        _debugSnapshotElapsedMs = 0.0f;
+
+        SAmplitudeDebugSnapshot& snapshot = _debugSnapshots.GetWriteSnapshot();
+        snapshot.sFrameStats = _stats.GetLastFrame();
+        snapshot.fBudgetMs = updateIntervalMs;
+        snapshot.cListenerVoiceCounts = _listeners.GetVoiceCounts();
+        snapshot.cResidentBanks = _residentBanks;
+        snapshot.cMemoryPools = GetMemoryPoolInfo();
+
+        // Amplitude has no per-entity bus send, the gains shown are the ones set on the buses themselves.
+        snapshot.cBusGains.clear();
+        for (const auto& [busId, referenceCount] : _environmentBuses)
+        {
+            if (const Bus bus = _engine->FindBus(busId); bus.Valid())
+            {
+                snapshot.cBusGains.emplace_back(busId, bus.GetGain());
+            }
+        }
+
+        _voiceLimiter.GetEventVoiceCounts(snapshot.cTopEvents);
+        AZStd::sort(
+            snapshot.cTopEvents.begin(),
+            snapshot.cTopEvents.end(),
+            [](const AZStd::pair<AmEventID, AZ::u32>& lhs, const AZStd::pair<AmEventID, AZ::u32>& rhs)
+            {
+                return lhs.second > rhs.second;
+            });
+
+        if (snapshot.cTopEvents.size() > kDebugTopEventCount)
+        {
+            snapshot.cTopEvents.resize(kDebugTopEventCount);
+        }
+
+        _debugSnapshots.Publish();
+    }
+#endif // !AMPLITUDE_RELEASE
+
+    void AmplitudeAudioSystem::ReleaseRetiredSoundBanks()
+    {
+        for (const SRetiredSoundBank& retiredBank : _retiredSoundBanks)
+        {
+            _engine->UnloadSoundBank(retiredBank.nAmBankID);
+            azfree(retiredBank.pOwnedFileData, Audio::AudioImplAllocator);
+        }
+
+        _retiredSoundBanks.clear();
     }
 } // namespace Audio
@@ -17,7 +17,26 @@
 #include <AudioAllocators.h>
 #include <IAudioSystemImplementation.h>
 
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
+
 #include <Engine/ATLEntities_amplitude.h>
+#include <Engine/AmplitudeAudioInputSource.h>
+#include <Engine/AmplitudeAudioStats.h>
+#include <Engine/AmplitudeControlCache.h>
+#include <Engine/AmplitudeDebugSnapshot.h>
+#include <Engine/AmplitudeEnvironmentRegistry.h>
+#include <Engine/AmplitudeListenerSet.h>
+#include <Engine/AmplitudeNullDriver.h>
+#include <Engine/AmplitudeOcclusionService.h>
+#include <Engine/AmplitudeRequestTrace.h>
+#include <Engine/AmplitudeSendRamps.h>
+#include <Engine/AmplitudeSpatialGrid.h>
+#include <Engine/AmplitudeTelemetryRecorder.h>
+#include <Engine/AmplitudeTriggerThrottle.h>
+#include <Engine/AmplitudeUpdateLod.h>
+#include <Engine/AmplitudeVoiceLimiter.h>
 
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
@@ -124,8 +143,67 @@ namespace Audio
         void SetPanningMode(PanningMode mode) override;
         // ~AudioSystemImplementationRequestBus
 
+        //! Registers a list of audio objects, as RegisterAudioObject() does for each of them.
+        EAudioRequestStatus RegisterAudioObjects(const AZStd::vector<IATLAudioObjectData*>& audioObjects);
+
+        //! Unregisters a list of audio objects. The internal object lists are visited once for the whole list instead
+        //! of once per object, which keeps level streaming from stalling the audio thread.
+        EAudioRequestStatus UnregisterAudioObjects(const AZStd::vector<IATLAudioObjectData*>& audioObjects);
+
+        TAudioSourceId CreateProceduralAudioSource(
+            const ProceduralAudioSourceConfig& sourceConfig, ProceduralAudioRenderCallback renderCallback);
+        void DestroyProceduralAudioSource(TAudioSourceId sourceId);
+
+        void SetOcclusionEmitterEnabled(TAudioObjectID audioObjectId, bool enabled);
+
+        //! Queues the tier used by the given panning mode, applied on the audio thread at the next update.
+        void SetPanningTier(PanningMode mode, PanningTier tier);
+        [[nodiscard]] PanningTier GetPanningTier() const;
+
+        [[nodiscard]] AZStd::vector<AZ::u32> GetUpdateLodBandCounts() const;
+        [[nodiscard]] AZStd::vector<ListenerVoiceCount> GetListenerVoiceCounts() const;
+        [[nodiscard]] AudioFrameStats GetAudioFrameStats() const;
+
+#if !defined(AMPLITUDE_RELEASE)
+        //! Gets the snapshots shown by the debug overlay, published by the audio thread while the overlay is enabled.
+        AmplitudeDebugSnapshotBuffer* GetDebugSnapshots()
+        {
+            return &_debugSnapshots;
+        }
+#endif // !AMPLITUDE_RELEASE
+
+        void SetAudioZone(AZ::u64 zoneId, const AZ::Aabb& bounds);
+        void RemoveAudioZone(AZ::u64 zoneId);
+        [[nodiscard]] AZStd::vector<AZStd::vector<TAudioObjectID>> QueryAudioObjects(const AZStd::vector<AudioObjectQuery>& queries) const;
+
+        //! Queues an offline render, run on the audio thread at the next update. See RenderOffline().
+        void RequestOfflineRender(const AZStd::string& timelinePath, const AZStd::string& outputPath);
+
+        //! Starts recording the calls made to this implementation into a request trace, at the next update.
+        void StartRequestCapture(const AZStd::string& tracePath);
+        void StopRequestCapture();
+
+        //! Queues the replay of a request trace, started on the audio thread at the next update. A speed of 0
+        //! replays the trace as fast as possible, blocking the audio thread until done.
+        void ReplayRequestCapture(const AZStd::string& tracePath, float speed);
+
+        [[nodiscard]] AZ::u32 GetMixerBlockSize() const;
+        [[nodiscard]] float GetMixerLatencyMs() const;
+
     protected:
         void SetBankPaths();
+        void LoadRuntimeSettings();
+        void UpdateLanguageSwitch();
+        void ApplyPanningTier();
+        void RunPendingPanningChanges();
+
+        //! Replaces the control cache with the cache files found under the given folder.
+        void LoadControlCache(const char* folderPath = AmplitudeControlsPath);
+
+        //! Finds the connection in the control cache, or returns nullptr if it should be parsed from the XML node.
+        //! Callers still check that the cached IDs exist in the loaded banks, the cache may be older than the banks.
+        [[nodiscard]] const SAmplitudeControlCacheEntry* FindCachedControl(
+            EAmplitudeControlCacheEntryType type, const AZ::rapidxml::xml_node<char>* node) const;
 
         AZStd::string m_soundbankFolder;
         AZStd::string m_localizedSoundbankFolder;
@@ -133,15 +211,73 @@ namespace Audio
 
     private:
         static constexpr char AmplitudeImplSubPath[] = "Amplitude";
+        static constexpr char AmplitudeControlsPath[] = "@products@/libs/gameaudio/amplitude";
         static constexpr char AmplitudeGlobalAudioObjectName[] = "AM-GlobalAudioObject";
         static constexpr float ObstructionOcclusionMin = 0.0f;
         static constexpr float ObstructionOcclusionMax = 1.0f;
+        static constexpr float DefaultTriggerPriority = 1.0f;
+        static constexpr AZ::u32 DefaultTriggerMaxInstances = 1;
 
         struct SEnvPairCompare
         {
             bool operator()(const AZStd::pair<const AmBusID, float>& pair1, const AZStd::pair<const AmBusID, float>& pair2) const;
         };
 
+        // A request capture or replay command, queued until the next update of the audio thread.
+        struct SRequestTraceCommand
+        {
+            enum EType : AZ::u8
+            {
+                eRTC_START_CAPTURE,
+                eRTC_STOP_CAPTURE,
+                eRTC_REPLAY,
+            };
+
+            EType eType;
+            AZStd::string sPath;
+            float fSpeed;
+        };
+
+        // A localized soundbank of the previous language, kept loaded until the new language is ready.
+        struct SRetiredSoundBank
+        {
+            AmBankID nAmBankID;
+            void* pOwnedFileData;
+        };
+
+        using TRetiredSoundBankVector = AZStd::vector<SRetiredSoundBank, AudioImplStdAllocator>;
+
+        enum class ELanguageSwitchState : AZ::u8
+        {
+            Idle,
+            Requested,
+            Loading,
+        };
+
+        bool LoadLocalizedSoundBank(SATLAudioFileEntryInfo* audioFileEntry, SATLAudioFileEntryData_Amplitude* implFileEntryData);
+        void RetireSoundBank(SATLAudioFileEntryData_Amplitude* implFileEntryData);
+        void ReleaseRetiredSoundBanks();
+        void RecordTelemetry();
+
+        //! Runs the engine update of one audio frame.
+        void UpdateFrame(float updateIntervalMs);
+
+        //! Plays the timeline and writes the mix to a WAV file, one mixer block per engine update. Blocks the audio
+        //! thread until done, and requires the null driver so that the mixer is only driven from here. Fails while
+        //! any voice is playing, as it would be mixed into the render.
+        bool RenderOffline(const AZStd::string& timelinePath, const AZStd::string& outputPath);
+        void RunPendingOfflineRenders();
+
+        void RunPendingRequestTraceCommands();
+
+        //! Replays the whole trace, with one engine update per recorded update. When the null driver is used, the
+        //! mixer is also driven by the replay, at the pace of the recorded updates.
+        void ReplayRequestsUnpaced();
+
+#if !defined(AMPLITUDE_RELEASE)
+        void PublishDebugSnapshot(float updateIntervalMs);
+#endif // !AMPLITUDE_RELEASE
+
         // SATLSwitchStateImplData_Amplitude* ParseWwiseSwitchOrState(const AZ::rapidxml::xml_node<char>* node, EWwiseSwitchType type);
         // SATLSwitchStateImplData_Amplitude* ParseWwiseRtpcSwitch(const AZ::rapidxml::xml_node<char>* node);
         // void ParseRtpcImpl(const AZ::rapidxml::xml_node<char>* node, AmRtpcID& akRtpcId, float& mult, float& shift);
@@ -159,6 +295,50 @@ namespace Audio
 
         AmBankID _initBankId;
 
+        AZStd::string _language;
+        ELanguageSwitchState _languageSwitchState;
+        TRetiredSoundBankVector _retiredSoundBanks;
+
+        // Sorted entities of the current UnregisterAudioObjects() call, kept to reuse its memory.
+        TAmUniqueIDVector _unregisteredEntityIds;
+
+        // Panning changes come from the game thread, they are queued and applied at the start of the next update.
+        // The current values are also read from the game thread, the mutex guards both.
+        mutable AZStd::mutex _panningMutex;
+        PanningMode _panningMode;
+        PanningTier _speakersPanningTier;
+        PanningTier _headphonesPanningTier;
+        AZStd::optional<PanningMode> _pendingPanningMode;
+        AZStd::optional<PanningTier> _pendingSpeakersPanningTier;
+        AZStd::optional<PanningTier> _pendingHeadphonesPanningTier;
+
+        // The tier last applied to the engine. Only used from the audio thread, so it is read without the mutex.
+        PanningTier _appliedPanningTier;
+
+        AmplitudeListenerSet _listeners;
+        AmplitudeUpdateLod _updateLod;
+        AmplitudeTriggerThrottle _triggerThrottle;
+        AmplitudeVoiceLimiter _voiceLimiter;
+        AmplitudeOcclusionService _occlusionService;
+        AmplitudeSendRamps _sendRamps;
+        AmplitudeSpatialGrid _spatialGrid;
+        AmplitudeEnvironmentRegistry _environments;
+        AmplitudeControlCache _controlCache;
+        AmplitudeAudioStats _stats;
+        AmplitudeTelemetryRecorder _telemetry;
+
+        AmplitudeAudioInputSourceManager _audioInputSources;
+        AmplitudeAudioInputCodec _audioInputCodec;
+        AmplitudeNullDriver _nullDriver;
+
+        AZStd::mutex _offlineRenderMutex;
+        AZStd::vector<AZStd::pair<AZStd::string, AZStd::string>> _pendingOfflineRenders;
+
+        AmplitudeRequestRecorder _requestRecorder;
+        AmplitudeRequestReplayer _requestReplayer;
+        AZStd::mutex _requestTraceMutex;
+        AZStd::vector<SRequestTraceCommand> _pendingRequestTraceCommands;
+
         FileLoader _fileLoader;
 
         Engine* _engine;
@@ -168,6 +348,13 @@ namespace Audio
         AZStd::vector<AudioImplMemoryPoolInfo> _debugMemoryInfo;
         AZStd::string _fullImplString;
         AZStd::string _speakerConfigString;
+
+        AmplitudeDebugSnapshotBuffer _debugSnapshots;
+        float _debugSnapshotElapsedMs;
+        AZStd::vector<SAmplitudeDebugSnapshot::SResidentBank> _residentBanks;
+
+        // Buses referenced by the bus environments of the loaded controls, with their number of references.
+        AZStd::map<AmBusID, AZ::u32, AZStd::less<AmBusID>, AudioImplStdAllocator> _environmentBuses;
 #endif // !AMPLITUDE_RELEASE
     };
 } // namespace Audio
@@ -0,0 +1,365 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/algorithm.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Config.h>
+#include <Engine/AmplitudeControlCache.h>
+#include <Engine/Common.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    struct SAmplitudeControlCacheHeader
+    {
+        char aMagic[4];
+        AZ::u32 nVersion;
+        AZ::u32 nEntryCount;
+        AZ::u32 nReserved;
+    };
+
+    static constexpr char kCacheMagic[4] = { 'A', 'M', 'C', 'C' };
+    static constexpr AZ::u32 kCacheVersion = 2;
+
+    static constexpr AZ::u64 kFnvOffsetBasis = 14695981039346656037ull;
+    static constexpr AZ::u64 kFnvPrime = 1099511628211ull;
+
+    static void HashBytes(AZ::u64& hash, const char* data, const size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= static_cast<AZ::u8>(data[i]);
+            hash *= kFnvPrime;
+        }
+
+        // Separates the strings, so that "ab" + "c" and "a" + "bc" don't collide.
+        hash ^= 0xFF;
+        hash *= kFnvPrime;
+    }
+
+    static void HashNode(AZ::u64& hash, const AZ::rapidxml::xml_node<char>* node)
+    {
+        HashBytes(hash, node->name(), node->name_size());
+
+        for (const auto* attr = node->first_attribute(); attr != nullptr; attr = attr->next_attribute())
+        {
+            HashBytes(hash, attr->name(), attr->name_size());
+            HashBytes(hash, attr->value(), attr->value_size());
+        }
+    }
+
+    static bool IsBefore(const SAmplitudeControlCacheEntry& entry, const AZ::u64 key, const AZ::u8 type)
+    {
+        return entry.nKey < key || (entry.nKey == key && entry.eType < type);
+    }
+
+    static bool ParseId(const AZ::rapidxml::xml_attribute<char>* attr, AZ::u64& id)
+    {
+        if (attr == nullptr || attr->value()[0] == '\0')
+        {
+            return false;
+        }
+
+        char* end = nullptr;
+        id = strtoull(attr->value(), &end, 10);
+
+        return *end == '\0';
+    }
+
+    // Fills the entry from a connection node, parsed the same way as the NewAudio*ImplData functions of the
+    // implementation. Returns false for nodes which are not Amplitude connections, or which miss an ID.
+    static bool ParseEntry(const AZ::rapidxml::xml_node<char>* node, SAmplitudeControlCacheEntry& entry)
+    {
+        const char* tag = node->name();
+        const auto* idAttr = node->first_attribute(XmlTags::kIdAttribute, 0, false);
+
+        if (azstricmp(tag, XmlTags::kEventTag) == 0)
+        {
+            entry.eType = eACCET_EVENT;
+
+            if (const auto* priorityAttr = node->first_attribute(XmlTags::kPriorityAttribute, 0, false);
+                priorityAttr && AZ::StringFunc::LooksLikeFloat(priorityAttr->value(), &entry.fPriority))
+            {
+                entry.nFlags |= eACCEF_HAS_PRIORITY;
+            }
+
+            if (const auto* windowAttr = node->first_attribute(XmlTags::kCoalescingWindowAttribute, 0, false);
+                windowAttr && AZ::StringFunc::LooksLikeFloat(windowAttr->value(), &entry.fCoalescingWindow))
+            {
+                entry.nFlags |= eACCEF_HAS_COALESCING_WINDOW;
+            }
+
+            if (const auto* maxInstancesAttr = node->first_attribute(XmlTags::kMaxInstancesAttribute, 0, false);
+                maxInstancesAttr && AZ::StringFunc::LooksLikeInt(maxInstancesAttr->value(), &entry.nMaxInstances))
+            {
+                entry.nFlags |= eACCEF_HAS_MAX_INSTANCES;
+            }
+
+            if (const auto* durationAttr = node->first_attribute(XmlTags::kDurationAttribute, 0, false);
+                durationAttr && AZ::StringFunc::LooksLikeFloat(durationAttr->value(), &entry.fDuration))
+            {
+                entry.nFlags |= eACCEF_HAS_DURATION;
+            }
+
+            return ParseId(idAttr, entry.nAmID) && entry.nAmID != kAmInvalidObjectId;
+        }
+
+        if (azstricmp(tag, XmlTags::kRtpcTag) == 0 || azstricmp(tag, XmlTags::kBusTag) == 0)
+        {
+            entry.eType = azstricmp(tag, XmlTags::kRtpcTag) == 0 ? eACCET_RTPC : eACCET_BUS;
+            return ParseId(idAttr, entry.nAmID) && entry.nAmID != kAmInvalidObjectId;
+        }
+
+        if (azstricmp(tag, XmlTags::kSwitchTag) == 0)
+        {
+            entry.eType = eACCET_SWITCH_STATE;
+
+            const auto* stateNode = node->first_node();
+            return stateNode && ParseId(idAttr, entry.nAmID) &&
+                ParseId(stateNode->first_attribute(XmlTags::kIdAttribute, 0, false), entry.nAmSecondaryID);
+        }
+
+        if (azstricmp(tag, XmlTags::kEnvironmentTag) == 0)
+        {
+            entry.eType = eACCET_ENVIRONMENT;
+
+            return ParseId(idAttr, entry.nAmID) &&
+                ParseId(node->first_attribute(XmlTags::kValueAttribute, 0, false), entry.nAmSecondaryID);
+        }
+
+        return false;
+    }
+
+    static bool IsConnectionTag(const char* tag)
+    {
+        return azstricmp(tag, XmlTags::kEventTag) == 0 || azstricmp(tag, XmlTags::kRtpcTag) == 0 ||
+            azstricmp(tag, XmlTags::kSwitchTag) == 0 || azstricmp(tag, XmlTags::kBusTag) == 0 ||
+            azstricmp(tag, XmlTags::kEnvironmentTag) == 0;
+    }
+
+    static void CollectEntries(const AZ::rapidxml::xml_node<char>* node, AZStd::vector<SAmplitudeControlCacheEntry>& entries)
+    {
+        for (const auto* child = node->first_node(); child != nullptr; child = child->next_sibling())
+        {
+            if (!IsConnectionTag(child->name()))
+            {
+                CollectEntries(child, entries);
+                continue;
+            }
+
+            SAmplitudeControlCacheEntry entry{};
+            if (ParseEntry(child, entry))
+            {
+                entry.nKey = AmplitudeControlCache::MakeKey(child);
+                entries.push_back(entry);
+            }
+        }
+    }
+
+    AZ::u64 AmplitudeControlCache::MakeKey(const AZ::rapidxml::xml_node<char>* node)
+    {
+        AZ::u64 hash = kFnvOffsetBasis;
+        HashNode(hash, node);
+
+        // The state of a switch connection is a child node.
+        if (const auto* child = node->first_node(); child != nullptr)
+        {
+            HashNode(hash, child);
+        }
+
+        return hash;
+    }
+
+    bool AmplitudeControlCache::Build(const AZ::rapidxml::xml_node<char>* rootNode, AZStd::vector<AZ::u8>& output)
+    {
+        AZStd::vector<SAmplitudeControlCacheEntry> entries;
+        CollectEntries(rootNode, entries);
+
+        if (entries.empty())
+        {
+            return false;
+        }
+
+        AZStd::sort(
+            entries.begin(),
+            entries.end(),
+            [](const SAmplitudeControlCacheEntry& lhs, const SAmplitudeControlCacheEntry& rhs)
+            {
+                return IsBefore(lhs, rhs.nKey, rhs.eType);
+            });
+
+        // A connection used by several controls is stored once, identical nodes are parsed to identical entries.
+        entries.erase(
+            AZStd::unique(
+                entries.begin(),
+                entries.end(),
+                [](const SAmplitudeControlCacheEntry& lhs, const SAmplitudeControlCacheEntry& rhs)
+                {
+                    return lhs.nKey == rhs.nKey && lhs.eType == rhs.eType;
+                }),
+            entries.end());
+
+        SAmplitudeControlCacheHeader header{};
+        memcpy(header.aMagic, kCacheMagic, sizeof(kCacheMagic));
+        header.nVersion = kCacheVersion;
+        header.nEntryCount = static_cast<AZ::u32>(entries.size());
+
+        const size_t entriesSize = entries.size() * sizeof(SAmplitudeControlCacheEntry);
+        output.resize(sizeof(header) + entriesSize);
+        memcpy(output.data(), &header, sizeof(header));
+        memcpy(output.data() + sizeof(header), entries.data(), entriesSize);
+
+        return true;
+    }
+
+    size_t AmplitudeControlCache::LoadFolder(const char* folderPath)
+    {
+        const size_t loadedCount = ReadFolder(folderPath);
+        SortEntries();
+
+        return loadedCount;
+    }
+
+    bool AmplitudeControlCache::LoadFile(const char* filePath)
+    {
+        if (!ReadFile(filePath))
+        {
+            return false;
+        }
+
+        SortEntries();
+        return true;
+    }
+
+    void AmplitudeControlCache::Clear()
+    {
+        _entries.clear();
+    }
+
+    const SAmplitudeControlCacheEntry* AmplitudeControlCache::Find(const EAmplitudeControlCacheEntryType type, const AZ::u64 key) const
+    {
+        const auto it = AZStd::lower_bound(
+            _entries.begin(),
+            _entries.end(),
+            key,
+            [type](const SAmplitudeControlCacheEntry& entry, const AZ::u64 value)
+            {
+                return IsBefore(entry, value, type);
+            });
+
+        if (it != _entries.end() && it->nKey == key && it->eType == type)
+        {
+            return &(*it);
+        }
+
+        return nullptr;
+    }
+
+    size_t AmplitudeControlCache::ReadFolder(const char* folderPath)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (fileIO == nullptr || !fileIO->IsDirectory(folderPath))
+        {
+            return 0;
+        }
+
+        size_t loadedCount = 0;
+
+        fileIO->FindFiles(
+            folderPath,
+            "*",
+            [this, fileIO, &loadedCount](const char* filePath) -> bool
+            {
+                if (fileIO->IsDirectory(filePath))
+                {
+                    loadedCount += ReadFolder(filePath);
+                }
+                else if (AZ::StringFunc::EndsWith(filePath, kControlCacheFileExtension, false) && ReadFile(filePath))
+                {
+                    ++loadedCount;
+                }
+
+                return true;
+            });
+
+        return loadedCount;
+    }
+
+    bool AmplitudeControlCache::ReadFile(const char* filePath)
+    {
+        AZ::IO::FileIOStream stream;
+        if (!stream.Open(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary))
+        {
+            return false;
+        }
+
+        SAmplitudeControlCacheHeader header{};
+        if (stream.Read(sizeof(header), &header) != sizeof(header) || memcmp(header.aMagic, kCacheMagic, sizeof(kCacheMagic)) != 0 ||
+            header.nVersion != kCacheVersion)
+        {
+            AZLOG_WARN("[Amplitude] Ignoring the control cache '%s', it was built by another version of the gem.", filePath);
+            return false;
+        }
+
+        const AZ::u64 entriesSize = static_cast<AZ::u64>(header.nEntryCount) * sizeof(SAmplitudeControlCacheEntry);
+        if (stream.GetLength() != sizeof(header) + entriesSize)
+        {
+            AZLOG_WARN("[Amplitude] Ignoring the truncated control cache '%s'.", filePath);
+            return false;
+        }
+
+        // Entries are read straight at the end of the table, without any conversion.
+        const size_t offset = _entries.size();
+        _entries.resize_no_construct(offset + header.nEntryCount);
+
+        if (stream.Read(entriesSize, _entries.data() + offset) != entriesSize)
+        {
+            _entries.resize(offset);
+            return false;
+        }
+
+        return true;
+    }
+
+    void AmplitudeControlCache::SortEntries()
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        AZStd::sort(
+            _entries.begin(),
+            _entries.end(),
+            [](const SAmplitudeControlCacheEntry& lhs, const SAmplitudeControlCacheEntry& rhs)
+            {
+                return IsBefore(lhs, rhs.nKey, rhs.eType);
+            });
+
+        // Identical nodes are parsed to identical entries, whatever the control file they come from.
+        _entries.erase(
+            AZStd::unique(
+                _entries.begin(),
+                _entries.end(),
+                [](const SAmplitudeControlCacheEntry& lhs, const SAmplitudeControlCacheEntry& rhs)
+                {
+                    return lhs.nKey == rhs.nKey && lhs.eType == rhs.eType;
+                }),
+            _entries.end());
+    }
+} // namespace Audio
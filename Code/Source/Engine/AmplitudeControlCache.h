@@ -0,0 +1,119 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AzCore/XML/rapidxml.h>
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Audio
+{
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    enum EAmplitudeControlCacheEntryType : AZ::u8
+    {
+        eACCET_EVENT = 0,
+        eACCET_RTPC = 1,
+        eACCET_SWITCH_STATE = 2, // nAmID: switch, nAmSecondaryID: state. Used by switch states and switch environments.
+        eACCET_BUS = 3,
+        eACCET_ENVIRONMENT = 4, // nAmID: environment, nAmSecondaryID: effect.
+
+        eACCET_COUNT
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    enum EAmplitudeControlCacheEntryFlags : AZ::u8
+    {
+        eACCEF_NONE = 0,
+        eACCEF_HAS_PRIORITY = 1 << 0,
+        eACCEF_HAS_COALESCING_WINDOW = 1 << 1,
+        eACCEF_HAS_MAX_INSTANCES = 1 << 2,
+        eACCEF_HAS_DURATION = 1 << 3,
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! One Amplitude connection of an audio control file, with its values already parsed by the control builder.
+    //!
+    //! Entries are stored as is in the cache file, so this struct must keep a fixed layout.
+    struct SAmplitudeControlCacheEntry
+    {
+        // Hash of the connection node, see AmplitudeControlCache::MakeKey().
+        AZ::u64 nKey;
+        AZ::u64 nAmID;
+        AZ::u64 nAmSecondaryID;
+        float fPriority;
+        float fCoalescingWindow;
+        AZ::s32 nMaxInstances;
+        float fDuration;
+        AZ::u8 eType;
+        AZ::u8 nFlags;
+        AZ::u8 aPadding[6];
+    };
+
+    static_assert(sizeof(SAmplitudeControlCacheEntry) == 48, "The layout of the control cache entries must not change.");
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Binary cache of the Amplitude connections of audio control files.
+    //!
+    //! The control builder emits one cache file next to each control file. A cache file is a small header followed
+    //! by the entries, sorted by key and type. The runtime reads the entries of every file straight into a single
+    //! table, sorted once loaded, and looks them up with one binary search, so the impl data of a connection can be
+    //! created without converting its attributes nor looking up its names in the engine. Connections missing from
+    //! the cache are parsed from the XML as before.
+    class AmplitudeControlCache
+    {
+    public:
+        //! Hashes the tag and the attributes of a connection node, and of its first child for switches. Two nodes
+        //! with the same key are parsed to the same values, whatever the control file they come from.
+        static AZ::u64 MakeKey(const AZ::rapidxml::xml_node<char>* node);
+
+        //! Collects the Amplitude connections of a control file, and serializes them into a cache file buffer.
+        //! @return false if the control file defines no connection that can be cached.
+        static bool Build(const AZ::rapidxml::xml_node<char>* rootNode, AZStd::vector<AZ::u8>& output);
+
+        //! Loads every cache file found under the given folder and its subfolders, and sorts their entries once.
+        //! @return The number of loaded files.
+        size_t LoadFolder(const char* folderPath);
+
+        //! Loads one cache file, after validating its header, and merges its entries into the table.
+        bool LoadFile(const char* filePath);
+
+        void Clear();
+
+        //! Finds the entry of the given type and key, or returns nullptr if the connection is not cached.
+        [[nodiscard]] const SAmplitudeControlCacheEntry* Find(EAmplitudeControlCacheEntryType type, AZ::u64 key) const;
+
+        [[nodiscard]] size_t GetEntryCount() const
+        {
+            return _entries.size();
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return _entries.empty();
+        }
+
+    private:
+        //! Appends the entries of the files of the folder to the table, without sorting them.
+        size_t ReadFolder(const char* folderPath);
+
+        //! Appends the entries of the file to the table, without sorting them.
+        bool ReadFile(const char* filePath);
+
+        //! Sorts the table, and drops the entries found in several files.
+        void SortEntries();
+
+        AZStd::vector<SAmplitudeControlCacheEntry> _entries;
+    };
+} // namespace Audio
@@ -0,0 +1,45 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Engine/AmplitudeDebugSnapshot.h>
+
+namespace Audio
+{
+    AmplitudeDebugSnapshotBuffer::AmplitudeDebugSnapshotBuffer()
+        : _writeIndex(0)
+        , _readIndex(1)
+        , _sharedIndex(2)
+        , _hasSnapshot(false)
+    {
+    }
+
+    void AmplitudeDebugSnapshotBuffer::Publish()
+    {
+        // Hand the written snapshot over, and take back whichever one the reader doesn't hold.
+        const AZ::u32 previous = _sharedIndex.exchange(_writeIndex | kFreshBit, AZStd::memory_order_acq_rel);
+        _writeIndex = previous & kIndexMask;
+    }
+
+    const SAmplitudeDebugSnapshot* AmplitudeDebugSnapshotBuffer::AcquireLatest()
+    {
+        if ((_sharedIndex.load(AZStd::memory_order_relaxed) & kFreshBit) != 0)
+        {
+            const AZ::u32 previous = _sharedIndex.exchange(_readIndex, AZStd::memory_order_acq_rel);
+            _readIndex = previous & kIndexMask;
+            _hasSnapshot = true;
+        }
+
+        return _hasSnapshot ? &_snapshots[_readIndex] : nullptr;
+    }
+} // namespace Audio
@@ -0,0 +1,86 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <IAudioSystemImplementation.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/utils.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+#include <SparkyStudios/Audio/Amplitude/AmplitudeAudioBus.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! State of the audio system shown by the debug overlay.
+    struct SAmplitudeDebugSnapshot
+    {
+        struct SResidentBank
+        {
+            AZStd::string sFileName;
+            AZ::u64 nSize;
+            bool bLocalized;
+        };
+
+        AudioFrameStats sFrameStats;
+        //! Time available to the audio update, in milliseconds.
+        float fBudgetMs = 0.0f;
+        AZStd::vector<ListenerVoiceCount> cListenerVoiceCounts;
+        //! Gains of the buses used by bus environments.
+        AZStd::vector<AZStd::pair<AmBusID, float>> cBusGains;
+        //! Events with the most real voices, sorted by voice count.
+        AZStd::vector<AZStd::pair<AmEventID, AZ::u32>> cTopEvents;
+        AZStd::vector<SResidentBank> cResidentBanks;
+        AZStd::vector<AudioImplMemoryPoolInfo> cMemoryPools;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Lock-free triple buffer of debug snapshots, written by the audio thread and read by a single reader thread.
+    //! The writer never waits for the reader, and the reader always sees the latest complete snapshot.
+    class AmplitudeDebugSnapshotBuffer
+    {
+    public:
+        AmplitudeDebugSnapshotBuffer();
+
+        //! Gets the snapshot to fill. Must only be called by the writer thread.
+        SAmplitudeDebugSnapshot& GetWriteSnapshot()
+        {
+            return _snapshots[_writeIndex];
+        }
+
+        //! Makes the snapshot returned by GetWriteSnapshot() visible to the reader.
+        void Publish();
+
+        //! Gets the latest published snapshot, or nullptr if none has been published yet. The snapshot stays valid
+        //! until the next call. Must only be called by the reader thread.
+        const SAmplitudeDebugSnapshot* AcquireLatest();
+
+    private:
+        static constexpr AZ::u32 kFreshBit = 0x4;
+        static constexpr AZ::u32 kIndexMask = 0x3;
+
+        AZStd::array<SAmplitudeDebugSnapshot, 3> _snapshots;
+        AZ::u32 _writeIndex;
+        AZ::u32 _readIndex;
+        AZStd::atomic<AZ::u32> _sharedIndex;
+        bool _hasSnapshot;
+    };
+} // namespace Audio
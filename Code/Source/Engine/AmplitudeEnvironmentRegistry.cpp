@@ -0,0 +1,77 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/ILogger.h>
+
+#include <Engine/AmplitudeEnvironmentRegistry.h>
+
+namespace Audio
+{
+    bool AmplitudeEnvironmentRegistry::Acquire(Engine* const engine, const AmEnvironmentID environmentId, const AmEffectID effectId)
+    {
+        if (const auto it = _environments.find(environmentId); it != _environments.end())
+        {
+            // An engine environment has a single effect, it can't be shared by definitions using different ones.
+            if (it->second.nAmEffectID != effectId)
+            {
+                AZLOG_WARN(
+                    "[Amplitude] The environment with ID %llu is already bound to the effect with ID %llu, ignoring the definition "
+                    "using the effect with ID %llu.",
+                    static_cast<unsigned long long>(environmentId), static_cast<unsigned long long>(it->second.nAmEffectID),
+                    static_cast<unsigned long long>(effectId));
+                return false;
+            }
+
+            ++it->second.nRefCount;
+            return true;
+        }
+
+        const EffectHandle effect = engine->GetEffectHandle(effectId);
+        if (effect == nullptr)
+        {
+            return false;
+        }
+
+        Environment environment = engine->AddEnvironment(environmentId);
+        if (!environment.Valid())
+        {
+            return false;
+        }
+
+        environment.SetEffect(effect);
+        _environments.emplace(environmentId, SEnvironment{ effectId, 1 });
+
+        return true;
+    }
+
+    void AmplitudeEnvironmentRegistry::Release(Engine* const engine, const AmEnvironmentID environmentId, const AmEffectID effectId)
+    {
+        const auto it = _environments.find(environmentId);
+        if (it == _environments.end() || it->second.nAmEffectID != effectId)
+        {
+            return;
+        }
+
+        if (--it->second.nRefCount == 0)
+        {
+            _environments.erase(it);
+            engine->RemoveEnvironment(environmentId);
+        }
+    }
+
+    void AmplitudeEnvironmentRegistry::Clear()
+    {
+        _environments.clear();
+    }
+} // namespace Audio
@@ -0,0 +1,67 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Shares the Amplitude environments between the ATL environments referencing them.
+    //!
+    //! The same environment is usually referenced from many control files. The first reference adds the
+    //! environment to the engine and binds its effect, the next ones only increase its reference count. The
+    //! environment is removed from the engine when its last reference is released.
+    class AmplitudeEnvironmentRegistry
+    {
+    public:
+        //! Adds a reference to the environment with the given effect, creating it in the engine if needed.
+        //! @return Whether the environment is available with that effect.
+        bool Acquire(Engine* engine, AmEnvironmentID environmentId, AmEffectID effectId);
+
+        //! Releases a reference to the environment, and removes it from the engine if it was the last one.
+        void Release(Engine* engine, AmEnvironmentID environmentId, AmEffectID effectId);
+
+        //! Forgets all the environments, without removing them from the engine.
+        void Clear();
+
+        [[nodiscard]] size_t GetEnvironmentCount() const
+        {
+            return _environments.size();
+        }
+
+    private:
+        struct SEnvironment
+        {
+            AmEffectID nAmEffectID;
+            AZ::u32 nRefCount;
+        };
+
+        using TEnvironmentMap = AZStd::unordered_map<
+            AmEnvironmentID,
+            SEnvironment,
+            AZStd::hash<AmEnvironmentID>,
+            AZStd::equal_to<AmEnvironmentID>,
+            AudioImplStdAllocator>;
+
+        TEnvironmentMap _environments;
+    };
+} // namespace Audio
@@ -0,0 +1,167 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <Engine/AmplitudeListenerSet.h>
+
+namespace Audio
+{
+    AmplitudeListenerSet::AmplitudeListenerSet()
+        : _hasPendingTransforms(false)
+    {
+    }
+
+    void AmplitudeListenerSet::AddListener(const AmListenerID listenerId)
+    {
+        if (FindListener(listenerId) == nullptr)
+        {
+            SListener listener;
+            listener.nAmListenerID = listenerId;
+            listener.vLocation = AM_Vec3(0.0f, 0.0f, 0.0f);
+            listener.vForward = AM_Vec3(0.0f, 1.0f, 0.0f);
+            listener.vUp = AM_Vec3(0.0f, 0.0f, 1.0f);
+            listener.bHasPendingTransform = false;
+            listener.nVoiceCount = 0;
+
+            _listeners.push_back(listener);
+        }
+    }
+
+    void AmplitudeListenerSet::RemoveListener(const AmListenerID listenerId)
+    {
+        _listeners.erase(
+            AZStd::remove_if(
+                _listeners.begin(),
+                _listeners.end(),
+                [listenerId](const SListener& listener)
+                {
+                    return listener.nAmListenerID == listenerId;
+                }),
+            _listeners.end());
+    }
+
+    void AmplitudeListenerSet::SetTransform(
+        const AmListenerID listenerId, const hmm_vec3& location, const hmm_vec3& forward, const hmm_vec3& up)
+    {
+        if (SListener* listener = FindListener(listenerId))
+        {
+            listener->vLocation = location;
+            listener->vForward = forward;
+            listener->vUp = up;
+            listener->bHasPendingTransform = true;
+            _hasPendingTransforms = true;
+        }
+    }
+
+    void AmplitudeListenerSet::Update(Engine* const engine)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        for (auto& listener : _listeners)
+        {
+            listener.nVoiceCount = 0;
+
+            if (!_hasPendingTransforms || !listener.bHasPendingTransform)
+            {
+                continue;
+            }
+
+            if (Listener amListener = engine->GetListener(listener.nAmListenerID); amListener.Valid())
+            {
+                amListener.SetLocation(listener.vLocation);
+                amListener.SetOrientation(listener.vForward, listener.vUp);
+            }
+
+            listener.bHasPendingTransform = false;
+        }
+
+        _hasPendingTransforms = false;
+    }
+
+    void AmplitudeListenerSet::CountVoice(const AmListenerID listenerId)
+    {
+        if (SListener* listener = FindListener(listenerId))
+        {
+            ++listener->nVoiceCount;
+        }
+    }
+
+    void AmplitudeListenerSet::PublishVoiceCounts()
+    {
+        AZStd::scoped_lock lock(_voiceCountsMutex);
+
+        _voiceCounts.resize(_listeners.size());
+
+        for (size_t i = 0; i < _listeners.size(); ++i)
+        {
+            _voiceCounts[i] = TListenerVoiceCount(_listeners[i].nAmListenerID, _listeners[i].nVoiceCount);
+        }
+    }
+
+    const AmplitudeListenerSet::SListener* AmplitudeListenerSet::FindNearest(const hmm_vec3& location) const
+    {
+        const SListener* nearest = nullptr;
+        float nearestDistanceSq = 0.0f;
+
+        for (const auto& listener : _listeners)
+        {
+            const float distanceSq = HMM_LengthSquaredVec3(HMM_SubtractVec3(location, listener.vLocation));
+
+            if (nearest == nullptr || distanceSq < nearestDistanceSq)
+            {
+                nearest = &listener;
+                nearestDistanceSq = distanceSq;
+            }
+        }
+
+        return nearest;
+    }
+
+    hmm_vec3 AmplitudeListenerSet::GetNearestLocation(const hmm_vec3& location) const
+    {
+        const SListener* nearest = FindNearest(location);
+        return nearest != nullptr ? nearest->vLocation : location;
+    }
+
+    AZStd::vector<AmplitudeListenerSet::TListenerVoiceCount> AmplitudeListenerSet::GetVoiceCounts() const
+    {
+        AZStd::scoped_lock lock(_voiceCountsMutex);
+        return _voiceCounts;
+    }
+
+    void AmplitudeListenerSet::Clear()
+    {
+        _listeners.clear();
+        _hasPendingTransforms = false;
+
+        AZStd::scoped_lock lock(_voiceCountsMutex);
+        _voiceCounts.clear();
+    }
+
+    AmplitudeListenerSet::SListener* AmplitudeListenerSet::FindListener(const AmListenerID listenerId)
+    {
+        for (auto& listener : _listeners)
+        {
+            if (listener.nAmListenerID == listenerId)
+            {
+                return &listener;
+            }
+        }
+
+        return nullptr;
+    }
+} // namespace Audio
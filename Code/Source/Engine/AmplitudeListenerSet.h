@@ -0,0 +1,100 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/utils.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+#include <SparkyStudios/Audio/Amplitude/AmplitudeAudioBus.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Tracks the listeners registered through the ATL.
+    //!
+    //! Listener transforms are batched and applied once per update. Amplitude spatializes each voice against
+    //! its nearest listener, and the bridge follows the same rule when it needs a listener for an entity
+    //! (voice scoring, update LOD, occlusion rays). The number of real voices attributed to each listener is
+    //! reported after each update.
+    class AmplitudeListenerSet
+    {
+    public:
+        struct SListener
+        {
+            AmListenerID nAmListenerID;
+            hmm_vec3 vLocation;
+            hmm_vec3 vForward;
+            hmm_vec3 vUp;
+            bool bHasPendingTransform;
+            AZ::u32 nVoiceCount;
+        };
+
+        using TListenerVoiceCount = SparkyStudios::Audio::Amplitude::ListenerVoiceCount;
+        using TListenerVector = AZStd::vector<SListener, AudioImplStdAllocator>;
+
+        AmplitudeListenerSet();
+
+        void AddListener(AmListenerID listenerId);
+        void RemoveListener(AmListenerID listenerId);
+
+        //! Records a new transform for the listener, applied on the next update.
+        void SetTransform(AmListenerID listenerId, const hmm_vec3& location, const hmm_vec3& forward, const hmm_vec3& up);
+
+        //! Applies the pending listener transforms, and resets the voice counts.
+        void Update(Engine* engine);
+
+        //! Attributes a real voice to the given listener.
+        void CountVoice(AmListenerID listenerId);
+
+        //! Makes the voice counts of this update visible to GetVoiceCounts().
+        void PublishVoiceCounts();
+
+        //! Gets the nearest listener to the given location, or nullptr if there is no listener.
+        [[nodiscard]] const SListener* FindNearest(const hmm_vec3& location) const;
+
+        //! Gets the location of the nearest listener to the given location, or the location itself if there is no listener.
+        [[nodiscard]] hmm_vec3 GetNearestLocation(const hmm_vec3& location) const;
+
+        //! Gets the number of real voices attributed to each listener during the last update. Can be called from any thread.
+        [[nodiscard]] AZStd::vector<TListenerVoiceCount> GetVoiceCounts() const;
+
+        [[nodiscard]] size_t GetListenerCount() const
+        {
+            return _listeners.size();
+        }
+
+        [[nodiscard]] const TListenerVector& GetListeners() const
+        {
+            return _listeners;
+        }
+
+        void Clear();
+
+    private:
+        SListener* FindListener(AmListenerID listenerId);
+
+        TListenerVector _listeners;
+        bool _hasPendingTransforms;
+
+        mutable AZStd::mutex _voiceCountsMutex;
+        AZStd::vector<TListenerVoiceCount> _voiceCounts;
+    };
+} // namespace Audio
@@ -0,0 +1,194 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <Engine/AmplitudeNullDriver.h>
+
+AZ_CVAR(
+    bool,
+    amp_nullDriverRealtime,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "When the null audio driver is used, mixes at the pace of the output sample rate. When disabled, mixes as fast as possible.");
+
+namespace Audio
+{
+    // Used when the engine configuration doesn't give a buffer size.
+    static constexpr AZ::u32 kDefaultBlockFrameCount = 512;
+
+    AmplitudeNullDriver::AmplitudeNullDriver()
+        : Driver(DriverName)
+        , _isRunning(false)
+        , _isOffline(false)
+        , _mixedFrameCount(0)
+        , _blockFrameCount(kDefaultBlockFrameCount)
+    {
+    }
+
+    AmplitudeNullDriver::~AmplitudeNullDriver()
+    {
+        Close();
+    }
+
+    bool AmplitudeNullDriver::Open(const DeviceDescription& device)
+    {
+        if (_isRunning)
+        {
+            return true;
+        }
+
+        m_deviceDescription = device;
+        m_deviceDescription.mDeviceName = DriverName;
+        m_deviceDescription.mDeviceOutputChannels = device.mRequestedOutputChannels;
+        // Only 16-bit integer and 32-bit float outputs are supported, which are the formats offline renders can write.
+        m_deviceDescription.mDeviceOutputFormat = device.mRequestedOutputFormat == PlaybackOutputFormat::Int16
+            ? PlaybackOutputFormat::Int16
+            : PlaybackOutputFormat::Float32;
+        m_deviceDescription.mDeviceOutputSampleRate = device.mRequestedOutputSampleRate;
+
+        const AZ::u32 channelCount = AZStd::max(static_cast<AZ::u32>(device.mRequestedOutputChannels), 1u);
+
+        // The buffer size is expressed in samples, for all the output channels.
+        _blockFrameCount = device.mOutputBufferSize >= channelCount ? device.mOutputBufferSize / channelCount : kDefaultBlockFrameCount;
+
+        // Sized for the widest sample format, the content is never read.
+        _buffer.resize(static_cast<size_t>(_blockFrameCount) * channelCount * sizeof(AmReal32));
+
+        _mixedFrameCount = 0;
+        _isRunning = true;
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Amplitude Null Driver";
+
+        _mixerThread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                MixerThread();
+            });
+
+        m_deviceDescription.mDeviceState = DeviceState::Started;
+
+        AZLOG_INFO(
+            "[Amplitude] Null driver opened: %u Hz, %u channels, %u frames per block.", m_deviceDescription.mDeviceOutputSampleRate,
+            channelCount, _blockFrameCount);
+
+        return true;
+    }
+
+    bool AmplitudeNullDriver::Close()
+    {
+        if (!_isRunning)
+        {
+            return true;
+        }
+
+        _isRunning = false;
+        _mixerThread.join();
+
+        m_deviceDescription.mDeviceState = DeviceState::Stopped;
+        return true;
+    }
+
+    void AmplitudeNullDriver::SetOffline(const bool offline)
+    {
+        // Once the lock is taken, the mixer thread is done with its block and won't start another one.
+        AZStd::scoped_lock lock(_mixMutex);
+        _isOffline = offline;
+    }
+
+    const AmUInt8* AmplitudeNullDriver::MixBlock()
+    {
+        AZStd::scoped_lock lock(_mixMutex);
+        MixBlockLocked();
+
+        return _buffer.data();
+    }
+
+    bool AmplitudeNullDriver::EnumerateDevices(std::vector<DeviceDescription>& devices)
+    {
+        DeviceDescription device;
+        device.mDeviceName = DriverName;
+        device.mDeviceState = _isRunning ? DeviceState::Started : DeviceState::Stopped;
+
+        devices.push_back(device);
+        return true;
+    }
+
+    void AmplitudeNullDriver::MixerThread()
+    {
+        using Clock = AZStd::chrono::steady_clock;
+
+        const AZ::u32 sampleRate = AZStd::max(static_cast<AZ::u32>(m_deviceDescription.mDeviceOutputSampleRate), 1u);
+        const auto blockDuration = AZStd::chrono::duration_cast<Clock::duration>(
+            AZStd::chrono::duration<double>(static_cast<double>(_blockFrameCount) / sampleRate));
+
+        Clock::time_point nextBlockTime = Clock::now();
+
+        while (_isRunning)
+        {
+            bool isOffline;
+
+            {
+                AZStd::scoped_lock lock(_mixMutex);
+
+                isOffline = _isOffline;
+                if (!isOffline)
+                {
+                    MixBlockLocked();
+                }
+            }
+
+            if (isOffline)
+            {
+                AZStd::this_thread::sleep_for(blockDuration);
+                nextBlockTime = Clock::now();
+                continue;
+            }
+
+            if (!amp_nullDriverRealtime)
+            {
+                // Faster than realtime, restart the clock in case realtime pacing is enabled again.
+                nextBlockTime = Clock::now();
+                continue;
+            }
+
+            nextBlockTime += blockDuration;
+
+            // Don't try to catch up after a stall, the mixer would burst through the missed blocks.
+            if (const Clock::time_point now = Clock::now(); nextBlockTime < now)
+            {
+                nextBlockTime = now;
+                continue;
+            }
+
+            AZStd::this_thread::sleep_until(nextBlockTime);
+        }
+    }
+
+    void AmplitudeNullDriver::MixBlockLocked()
+    {
+        AZ_PROFILE_SCOPE(Audio, "Amplitude::NullDriver::Mix");
+
+        amEngine->GetMixer()->Mix(_buffer.data(), _blockFrameCount);
+        _mixedFrameCount += _blockFrameCount;
+    }
+} // namespace Audio
@@ -0,0 +1,108 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Amplitude driver mixing into a discarded buffer, for machines without an audio device.
+    //!
+    //! The driver is selected by setting "null" as the driver of the engine configuration. Once opened, a thread
+    //! pulls one mixer block at a time, either at the pace of the output sample rate, or as fast as possible when
+    //! the amp_nullDriverRealtime CVar is disabled. In offline mode, the thread stops and blocks are only mixed
+    //! on demand with MixBlock(), so that the caller controls the pace of both the engine and the mixer.
+    class AmplitudeNullDriver final : public Driver
+    {
+    public:
+        static constexpr const char* DriverName = "null";
+
+        AmplitudeNullDriver();
+        ~AmplitudeNullDriver() override;
+
+        bool Open(const DeviceDescription& device) override;
+        bool Close() override;
+        bool EnumerateDevices(std::vector<DeviceDescription>& devices) override;
+
+        //! Stops or resumes the mixer thread. While offline, blocks are only mixed by MixBlock().
+        void SetOffline(bool offline);
+
+        //! Mixes one block on the calling thread.
+        //! @return The mixed block, valid until the next call, of GetBlockByteSize() bytes.
+        const AmUInt8* MixBlock();
+
+        [[nodiscard]] bool IsOpen() const
+        {
+            return _isRunning;
+        }
+
+        [[nodiscard]] AZ::u32 GetBlockFrameCount() const
+        {
+            return _blockFrameCount;
+        }
+
+        [[nodiscard]] AZ::u32 GetBlockByteSize() const
+        {
+            return _blockFrameCount * GetChannelCount() * GetBytesPerSample();
+        }
+
+        [[nodiscard]] AZ::u32 GetSampleRate() const
+        {
+            return m_deviceDescription.mDeviceOutputSampleRate;
+        }
+
+        [[nodiscard]] AZ::u16 GetChannelCount() const
+        {
+            return AZStd::max(static_cast<AZ::u16>(m_deviceDescription.mDeviceOutputChannels), AZ::u16(1));
+        }
+
+        [[nodiscard]] AZ::u16 GetBytesPerSample() const
+        {
+            return IsFloatOutput() ? sizeof(AmReal32) : sizeof(AmInt16);
+        }
+
+        [[nodiscard]] bool IsFloatOutput() const
+        {
+            return m_deviceDescription.mDeviceOutputFormat == PlaybackOutputFormat::Float32;
+        }
+
+        //! Gets the number of frames mixed since the driver has been opened.
+        [[nodiscard]] AZ::u64 GetMixedFrameCount() const
+        {
+            return _mixedFrameCount;
+        }
+
+    private:
+        void MixerThread();
+        void MixBlockLocked();
+
+        AZStd::thread _mixerThread;
+        AZStd::atomic_bool _isRunning;
+        AZStd::mutex _mixMutex;
+        bool _isOffline;
+        AZStd::atomic<AZ::u64> _mixedFrameCount;
+        AZStd::vector<AmUInt8> _buffer;
+        AZ::u32 _blockFrameCount;
+    };
+} // namespace Audio
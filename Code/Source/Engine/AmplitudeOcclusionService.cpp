@@ -0,0 +1,321 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <cmath>
+
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+
+#include <Engine/AmplitudeOcclusionService.h>
+
+namespace Audio
+{
+    // Rays stop short of both ends, so that the listener and emitter colliders don't occlude themselves.
+    static constexpr float kRayEndMargin = 0.25f;
+
+    // A ray without result after this time is considered lost, e.g. when the physics scene has been removed.
+    static constexpr AmTime kRayTimeout = 1.0;
+
+    static AZ::Vector3 AmVec3ToAZVec3(const hmm_vec3& vec)
+    {
+        return AZ::Vector3(vec.X, vec.Y, vec.Z);
+    }
+
+    AmplitudeOcclusionService::AmplitudeOcclusionService(
+        const AmplitudeListenerSet* const listeners, const AmplitudeSpatialGrid* const spatialGrid)
+        : _listeners(listeners)
+        , _spatialGrid(spatialGrid)
+        , _rayResults(AZStd::make_shared<SRayResultQueue>())
+        , _nextRequestId(0)
+        , _isEnabled(false)
+        , _raysPerFrame(DefaultRaysPerFrame)
+        , _smoothingTime(DefaultSmoothingTime)
+        , _maxDistance(DefaultMaxDistance)
+    {
+    }
+
+    void AmplitudeOcclusionService::SetEnabled(const bool enabled)
+    {
+        _isEnabled = enabled;
+    }
+
+    void AmplitudeOcclusionService::SetRaysPerFrame(const AZ::u32 raysPerFrame)
+    {
+        _raysPerFrame = raysPerFrame;
+    }
+
+    void AmplitudeOcclusionService::SetSmoothingTime(const AmTime smoothingTime)
+    {
+        _smoothingTime = AZStd::max(smoothingTime, 0.0);
+    }
+
+    void AmplitudeOcclusionService::SetMaxDistance(const float maxDistance)
+    {
+        _maxDistance = AZStd::max(maxDistance, kRayEndMargin * 2.0f);
+    }
+
+    void AmplitudeOcclusionService::SetEmitterEnabled(const AmEntityID entityId, const bool enabled)
+    {
+        AZStd::scoped_lock lock(_registrationMutex);
+        _registrations.emplace_back(entityId, enabled);
+    }
+
+    bool AmplitudeOcclusionService::IsEmitter(const AmEntityID entityId) const
+    {
+        return _isEnabled && _emitters.find(entityId) != _emitters.end();
+    }
+
+    void AmplitudeOcclusionService::ForgetEntity(const AmEntityID entityId)
+    {
+        _emitters.erase(entityId);
+    }
+
+    void AmplitudeOcclusionService::ForgetEntities(const TAmUniqueIDVector& sortedEntityIds)
+    {
+        if (_emitters.empty())
+        {
+            return;
+        }
+
+        for (const AmEntityID entityId : sortedEntityIds)
+        {
+            _emitters.erase(entityId);
+        }
+    }
+
+    void AmplitudeOcclusionService::Update(Engine* const engine, const AmplitudeVoiceLimiter& voiceLimiter, const AmTime deltaTime)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        ApplyRegistrations();
+        ApplyRayResults();
+
+        // The ATL keeps setting the occlusion of all the entities while the service is disabled.
+        if (!_isEnabled)
+        {
+            return;
+        }
+
+        for (auto& [entityId, emitter] : _emitters)
+        {
+            emitter.fTimeSinceRay += deltaTime;
+
+            if (emitter.bRayPending && emitter.fTimeSinceRay > kRayTimeout)
+            {
+                emitter.bRayPending = false;
+            }
+        }
+
+        if (_raysPerFrame > 0 && _listeners->GetListenerCount() > 0)
+        {
+            CastRays(engine, voiceLimiter);
+        }
+
+        // Exponential smoothing, independent of the update rate.
+        const float blend = _smoothingTime > 0.0 ? static_cast<float>(1.0 - std::exp(-deltaTime / _smoothingTime)) : 1.0f;
+
+        for (auto& [entityId, emitter] : _emitters)
+        {
+            emitter.fOcclusion += (emitter.fTargetOcclusion - emitter.fOcclusion) * blend;
+
+            if (Entity entity = engine->GetEntity(entityId); entity.Valid())
+            {
+                entity.SetOcclusion(emitter.fOcclusion);
+            }
+        }
+    }
+
+    void AmplitudeOcclusionService::Clear()
+    {
+        _emitters.clear();
+
+        // Drop the results of the queries still in flight.
+        _rayResults = AZStd::make_shared<SRayResultQueue>();
+
+        AZStd::scoped_lock lock(_registrationMutex);
+        _registrations.clear();
+    }
+
+    void AmplitudeOcclusionService::ApplyRegistrations()
+    {
+        AZStd::scoped_lock lock(_registrationMutex);
+
+        for (const auto& [entityId, enabled] : _registrations)
+        {
+            if (enabled)
+            {
+                _emitters.try_emplace(entityId, SEmitter{ 0.0f, 0.0f, 0.0, false });
+            }
+            else
+            {
+                _emitters.erase(entityId);
+            }
+        }
+
+        _registrations.clear();
+    }
+
+    void AmplitudeOcclusionService::ApplyRayResults()
+    {
+        AZStd::scoped_lock lock(_rayResults->mutex);
+
+        for (const auto& result : _rayResults->results)
+        {
+            if (const auto it = _emitters.find(result.nAmEntityID); it != _emitters.end())
+            {
+                it->fTargetOcclusion = result.bHit ? 1.0f : 0.0f;
+                it->fTimeSinceRay = 0.0;
+                it->bRayPending = false;
+            }
+        }
+
+        _rayResults->results.clear();
+    }
+
+    void AmplitudeOcclusionService::CastRays(Engine* const engine, const AmplitudeVoiceLimiter& voiceLimiter)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (sceneInterface == nullptr)
+        {
+            return;
+        }
+
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        if (sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            return;
+        }
+
+        // Only the entities within the maximum distance of a listener can get a ray, the grid finds them without visiting the
+        // others. An entity near several listeners is found once per listener.
+        _entitiesInRange.clear();
+
+        for (const auto& listener : _listeners->GetListeners())
+        {
+            _spatialGrid->Query(
+                AmplitudeSpatialGrid::SQuery{ AmplitudeSpatialGrid::eSQT_RADIUS, listener.vLocation, listener.vLocation, _maxDistance, 0 },
+                _entitiesInRange);
+        }
+
+        AZStd::sort(_entitiesInRange.begin(), _entitiesInRange.end());
+        _entitiesInRange.erase(AZStd::unique(_entitiesInRange.begin(), _entitiesInRange.end()), _entitiesInRange.end());
+
+        // Silent emitters are skipped, the others are ranked by their voice score and the age of their last result.
+        _candidates.clear();
+        voiceLimiter.GetRealVoiceScores(_voiceScores);
+
+        for (const AmEntityID entityId : _entitiesInRange)
+        {
+            const auto emitter = _emitters.find(entityId);
+            if (emitter == _emitters.end() || emitter->second.bRayPending)
+            {
+                continue;
+            }
+
+            const auto score = _voiceScores.find(entityId);
+            if (score == _voiceScores.end() || score->second <= 0.0f)
+            {
+                continue;
+            }
+
+            _candidates.emplace_back(score->second * static_cast<float>(1.0 + emitter->second.fTimeSinceRay), &*emitter);
+        }
+
+        if (_candidates.empty())
+        {
+            return;
+        }
+
+        const size_t rayCount = AZStd::min<size_t>(_raysPerFrame, _candidates.size());
+        AZStd::sort(
+            _candidates.begin(),
+            _candidates.end(),
+            [](const auto& a, const auto& b)
+            {
+                return a.first > b.first;
+            });
+
+        AzPhysics::SceneQueryRequests requests;
+        AZStd::vector<AmEntityID> entityIds;
+        requests.reserve(rayCount);
+        entityIds.reserve(rayCount);
+
+        for (size_t i = 0; i < rayCount; ++i)
+        {
+            const AmEntityID entityId = _candidates[i].second->first;
+            SEmitter& emitter = _candidates[i].second->second;
+
+            const Entity entity = engine->GetEntity(entityId);
+            if (!entity.Valid())
+            {
+                continue;
+            }
+
+            const AZ::Vector3 start = AmVec3ToAZVec3(_listeners->GetNearestLocation(entity.GetLocation()));
+            const AZ::Vector3 direction = AmVec3ToAZVec3(entity.GetLocation()) - start;
+            const float distance = direction.GetLength();
+
+            if (distance <= kRayEndMargin * 2.0f || distance > _maxDistance)
+            {
+                // Too close to be occluded, or too far to matter.
+                emitter.fTargetOcclusion = 0.0f;
+                emitter.fTimeSinceRay = 0.0;
+                continue;
+            }
+
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = start + direction * (kRayEndMargin / distance);
+            request->m_direction = direction / distance;
+            request->m_distance = distance - kRayEndMargin * 2.0f;
+            request->m_reportMultipleHits = false;
+
+            requests.push_back(AZStd::move(request));
+            entityIds.push_back(entityId);
+            emitter.bRayPending = true;
+        }
+
+        if (requests.empty())
+        {
+            return;
+        }
+
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(
+            sceneHandle,
+            _nextRequestId++,
+            requests,
+            [rayResults = _rayResults, entityIds = AZStd::move(entityIds)](
+                [[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hitsList)
+            {
+                AZStd::scoped_lock lock(rayResults->mutex);
+
+                for (size_t i = 0; i < hitsList.size() && i < entityIds.size(); ++i)
+                {
+                    rayResults->results.push_back(SRayResult{ entityIds[i], !hitsList[i].m_hits.empty() });
+                }
+            });
+
+        if (!queued)
+        {
+            for (size_t i = 0; i < rayCount; ++i)
+            {
+                _candidates[i].second->second.bRayPending = false;
+            }
+        }
+    }
+} // namespace Audio
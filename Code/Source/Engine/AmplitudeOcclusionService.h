@@ -0,0 +1,129 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/utils.h>
+
+#include <Engine/AmplitudeListenerSet.h>
+#include <Engine/AmplitudeSpatialGrid.h>
+#include <Engine/AmplitudeVoiceLimiter.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Computes the occlusion of registered emitters with asynchronous physics raycasts.
+    //!
+    //! Each update, at most a fixed number of rays are cast from the nearest listener to the emitters, favoring
+    //! the audible emitters which are the most relevant to the voice limiter and which were not checked for the
+    //! longest time. Only the emitters the spatial grid finds within the maximum distance of a listener are
+    //! ranked. Ray results are smoothed over time and applied directly on the Amplitude entities.
+    //! While the service is enabled, the occlusion of registered emitters is owned by it, and values set through the ATL
+    //! are ignored. A disabled service leaves the occlusion of all the entities to the ATL.
+    class AmplitudeOcclusionService
+    {
+    public:
+        static constexpr AZ::u32 DefaultRaysPerFrame = 8;
+        static constexpr AmTime DefaultSmoothingTime = 0.15;
+        static constexpr float DefaultMaxDistance = 100.0f;
+
+        AmplitudeOcclusionService(const AmplitudeListenerSet* listeners, const AmplitudeSpatialGrid* spatialGrid);
+
+        void SetEnabled(bool enabled);
+        void SetRaysPerFrame(AZ::u32 raysPerFrame);
+        void SetSmoothingTime(AmTime smoothingTime);
+        void SetMaxDistance(float maxDistance);
+
+        [[nodiscard]] bool IsEnabled() const
+        {
+            return _isEnabled;
+        }
+
+        //! Registers or unregisters an emitter. Can be called from any thread, the change is applied on the next update.
+        void SetEmitterEnabled(AmEntityID entityId, bool enabled);
+
+        //! Checks whether the occlusion of the given entity is computed by the service, which is never the case while disabled.
+        [[nodiscard]] bool IsEmitter(AmEntityID entityId) const;
+
+        //! Unregisters the given entity, called when its audio object is unregistered.
+        void ForgetEntity(AmEntityID entityId);
+
+        //! Unregisters the given entities, sorted in ascending order.
+        void ForgetEntities(const TAmUniqueIDVector& sortedEntityIds);
+
+        //! Collects ray results, casts new rays within the budget, and applies the smoothed occlusion values.
+        void Update(Engine* engine, const AmplitudeVoiceLimiter& voiceLimiter, AmTime deltaTime);
+
+        void Clear();
+
+    private:
+        struct SEmitter
+        {
+            float fTargetOcclusion;
+            float fOcclusion;
+            AmTime fTimeSinceRay;
+            bool bRayPending;
+        };
+
+        struct SRayResult
+        {
+            AmEntityID nAmEntityID;
+            bool bHit;
+        };
+
+        // Filled from the physics thread, drained by the audio thread. Shared with the pending queries, so that
+        // results arriving after the service is cleared are simply dropped.
+        struct SRayResultQueue
+        {
+            AZStd::mutex mutex;
+            AZStd::vector<SRayResult, AudioImplStdAllocator> results;
+        };
+
+        using TEmitterMap =
+            AZStd::unordered_map<AmEntityID, SEmitter, AZStd::hash<AmEntityID>, AZStd::equal_to<AmEntityID>, AudioImplStdAllocator>;
+        using TEmitterRegistration = AZStd::pair<AmEntityID, bool>;
+
+        void ApplyRegistrations();
+        void ApplyRayResults();
+        void CastRays(Engine* engine, const AmplitudeVoiceLimiter& voiceLimiter);
+
+        TEmitterMap _emitters;
+        AZStd::vector<AZStd::pair<float, TEmitterMap::value_type*>, AudioImplStdAllocator> _candidates;
+        AmplitudeVoiceLimiter::TEntityScoreMap _voiceScores;
+        AmplitudeSpatialGrid::TEntityVector _entitiesInRange;
+
+        AZStd::mutex _registrationMutex;
+        AZStd::vector<TEmitterRegistration, AudioImplStdAllocator> _registrations;
+
+        const AmplitudeListenerSet* _listeners;
+        const AmplitudeSpatialGrid* _spatialGrid;
+        AZStd::shared_ptr<SRayResultQueue> _rayResults;
+        AZ::u32 _nextRequestId;
+
+        bool _isEnabled;
+        AZ::u32 _raysPerFrame;
+        AmTime _smoothingTime;
+        float _maxDistance;
+    };
+} // namespace Audio
@@ -0,0 +1,216 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/algorithm.h>
+
+#include <Engine/AmplitudeOfflineRender.h>
+
+namespace Audio
+{
+    static constexpr char kDurationKey[] = "duration";
+    static constexpr char kEntriesKey[] = "entries";
+    static constexpr char kTimeKey[] = "time";
+    static constexpr char kTypeKey[] = "type";
+    static constexpr char kEntityKey[] = "entity";
+    static constexpr char kNameKey[] = "name";
+    static constexpr char kPositionKey[] = "position";
+    static constexpr char kValueKey[] = "value";
+
+    static constexpr const char* kEntryTypeNames[] = { "trigger", "stop", "position", "rtpc" };
+
+    // Size of the RIFF, fmt and data chunk headers of a PCM WAV file.
+    static constexpr AZ::u32 kWavHeaderSize = 44;
+    static constexpr AZ::u16 kWavFormatPcm = 1;
+    static constexpr AZ::u16 kWavFormatFloat = 3;
+
+    static bool ParseEntryType(const char* name, AmplitudeOfflineTimeline::EEntryType& type)
+    {
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(kEntryTypeNames); ++i)
+        {
+            if (azstricmp(name, kEntryTypeNames[i]) == 0)
+            {
+                type = static_cast<AmplitudeOfflineTimeline::EEntryType>(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static void WriteLE(AZ::u8*& out, const AZ::u32 value, const size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            *out++ = static_cast<AZ::u8>((value >> (8 * i)) & 0xFF);
+        }
+    }
+
+    bool AmplitudeOfflineTimeline::Load(const rapidjson::Document& document)
+    {
+        _entries.clear();
+        _duration = 0.0;
+
+        if (!document.IsObject() || !document.HasMember(kEntriesKey) || !document[kEntriesKey].IsArray())
+        {
+            AZLOG_ERROR("[Amplitude] The offline render timeline must have an '%s' array.", kEntriesKey);
+            return false;
+        }
+
+        for (const auto& item : document[kEntriesKey].GetArray())
+        {
+            SEntry entry{ 0.0, eOTE_TRIGGER, 0, {}, AM_Vec3(0.0f, 0.0f, 0.0f), 0.0f };
+
+            if (!item.IsObject() || !item.HasMember(kTimeKey) || !item[kTimeKey].IsNumber() || !item.HasMember(kTypeKey) ||
+                !item[kTypeKey].IsString() || !ParseEntryType(item[kTypeKey].GetString(), entry.eType) || !item.HasMember(kEntityKey) ||
+                !item[kEntityKey].IsUint64())
+            {
+                AZLOG_WARN("[Amplitude] Skipping an offline render entry without a valid time, type or entity.");
+                continue;
+            }
+
+            entry.fTime = AZStd::max(item[kTimeKey].GetDouble(), 0.0);
+            entry.nEntityID = item[kEntityKey].GetUint64();
+
+            if (item.HasMember(kNameKey) && item[kNameKey].IsString())
+            {
+                entry.sName = item[kNameKey].GetString();
+            }
+
+            if (item.HasMember(kValueKey) && item[kValueKey].IsNumber())
+            {
+                entry.fValue = item[kValueKey].GetFloat();
+            }
+
+            if (item.HasMember(kPositionKey) && item[kPositionKey].IsArray() && item[kPositionKey].Size() == 3)
+            {
+                const auto& position = item[kPositionKey];
+                entry.vPosition = AM_Vec3(position[0].GetFloat(), position[1].GetFloat(), position[2].GetFloat());
+            }
+
+            const bool needsName = entry.eType == eOTE_TRIGGER || entry.eType == eOTE_RTPC;
+            if (needsName && entry.sName.empty())
+            {
+                AZLOG_WARN("[Amplitude] Skipping a '%s' offline render entry without a name.", kEntryTypeNames[entry.eType]);
+                continue;
+            }
+
+            _entries.push_back(AZStd::move(entry));
+        }
+
+        // Entries at the same time keep the order of the file.
+        AZStd::stable_sort(
+            _entries.begin(),
+            _entries.end(),
+            [](const SEntry& lhs, const SEntry& rhs)
+            {
+                return lhs.fTime < rhs.fTime;
+            });
+
+        if (document.HasMember(kDurationKey) && document[kDurationKey].IsNumber())
+        {
+            _duration = AZStd::max(document[kDurationKey].GetDouble(), 0.0);
+        }
+        else
+        {
+            _duration = (_entries.empty() ? 0.0 : _entries.back().fTime) + DefaultTailDuration;
+        }
+
+        return true;
+    }
+
+    AmplitudeWavWriter::~AmplitudeWavWriter()
+    {
+        Close();
+    }
+
+    bool AmplitudeWavWriter::Open(
+        const AZStd::string& path, const AZ::u32 sampleRate, const AZ::u16 channelCount, const AZ::u16 bitsPerSample, const bool isFloat)
+    {
+        char resolvedPath[AZ_MAX_PATH_LEN] = { 0 };
+        if (AZ::IO::FileIOBase::GetInstance() == nullptr ||
+            !AZ::IO::FileIOBase::GetInstance()->ResolvePath(path.c_str(), resolvedPath, AZ_MAX_PATH_LEN))
+        {
+            azstrcpy(resolvedPath, AZ_MAX_PATH_LEN, path.c_str());
+        }
+
+        constexpr int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+
+        if (!_file.Open(resolvedPath, openMode))
+        {
+            AZLOG_ERROR("[Amplitude] Unable to create the WAV file '%s'.", resolvedPath);
+            return false;
+        }
+
+        _sampleRate = sampleRate;
+        _channelCount = channelCount;
+        _bitsPerSample = bitsPerSample;
+        _isFloat = isFloat;
+        _dataSize = 0;
+
+        // Sizes are written again on Close().
+        WriteHeader();
+        return true;
+    }
+
+    void AmplitudeWavWriter::Write(const void* data, const AZ::u64 size)
+    {
+        if (_file.IsOpen())
+        {
+            _dataSize += _file.Write(data, size);
+        }
+    }
+
+    void AmplitudeWavWriter::Close()
+    {
+        if (!_file.IsOpen())
+        {
+            return;
+        }
+
+        _file.Seek(0, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        WriteHeader();
+        _file.Close();
+    }
+
+    void AmplitudeWavWriter::WriteHeader()
+    {
+        // The RIFF sizes are 32-bit, longer renders are truncated in the header.
+        const auto dataSize = static_cast<AZ::u32>(AZStd::min<AZ::u64>(_dataSize, 0xFFFFFFFFu - kWavHeaderSize));
+        const AZ::u32 blockAlign = _channelCount * (_bitsPerSample / 8u);
+
+        AZ::u8 header[kWavHeaderSize];
+        AZ::u8* out = header;
+
+        memcpy(out, "RIFF", 4);
+        out += 4;
+        WriteLE(out, kWavHeaderSize - 8 + dataSize, 4);
+        memcpy(out, "WAVEfmt ", 8);
+        out += 8;
+        WriteLE(out, 16, 4);
+        WriteLE(out, _isFloat ? kWavFormatFloat : kWavFormatPcm, 2);
+        WriteLE(out, _channelCount, 2);
+        WriteLE(out, _sampleRate, 4);
+        WriteLE(out, _sampleRate * blockAlign, 4);
+        WriteLE(out, blockAlign, 2);
+        WriteLE(out, _bitsPerSample, 2);
+        memcpy(out, "data", 4);
+        out += 4;
+        WriteLE(out, dataSize, 4);
+
+        _file.Write(header, kWavHeaderSize);
+    }
+} // namespace Audio
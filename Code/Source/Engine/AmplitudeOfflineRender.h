@@ -0,0 +1,110 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! A scripted list of ATL calls, rendered offline by AmplitudeAudioSystem::RenderOffline().
+    //!
+    //! Timelines are JSON files with an optional "duration" in seconds, and an "entries" array. Each entry has a
+    //! "time" in seconds, a "type" and an "entity" number, plus the fields of its type:
+    //! - "trigger": the "name" of the event to play.
+    //! - "stop": stops all the events of the entity.
+    //! - "position": the "position" of the entity, as an array of 3 numbers.
+    //! - "rtpc": the "name" of the RTPC, and its "value".
+    class AmplitudeOfflineTimeline
+    {
+    public:
+        //! Time rendered after the last entry when the timeline doesn't give a duration.
+        static constexpr double DefaultTailDuration = 2.0;
+
+        enum EEntryType : AZ::u8
+        {
+            eOTE_TRIGGER,
+            eOTE_STOP,
+            eOTE_POSITION,
+            eOTE_RTPC,
+        };
+
+        struct SEntry
+        {
+            double fTime;
+            EEntryType eType;
+            AZ::u64 nEntityID;
+            AZStd::string sName;
+            hmm_vec3 vPosition;
+            float fValue;
+        };
+
+        //! Reads the timeline, and sorts its entries by time.
+        //! @return Whether the timeline is valid. Invalid entries are skipped with a warning.
+        bool Load(const rapidjson::Document& document);
+
+        [[nodiscard]] const AZStd::vector<SEntry>& GetEntries() const
+        {
+            return _entries;
+        }
+
+        [[nodiscard]] double GetDuration() const
+        {
+            return _duration;
+        }
+
+    private:
+        AZStd::vector<SEntry> _entries;
+        double _duration = 0.0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Writes interleaved 16-bit integer or 32-bit float samples to a WAV file.
+    class AmplitudeWavWriter
+    {
+    public:
+        ~AmplitudeWavWriter();
+
+        //! Creates the file, overwriting any existing one. The path can contain file IO aliases.
+        bool Open(const AZStd::string& path, AZ::u32 sampleRate, AZ::u16 channelCount, AZ::u16 bitsPerSample, bool isFloat);
+
+        void Write(const void* data, AZ::u64 size);
+
+        //! Writes the final sizes in the header, and closes the file.
+        void Close();
+
+        [[nodiscard]] AZ::u64 GetDataSize() const
+        {
+            return _dataSize;
+        }
+
+    private:
+        void WriteHeader();
+
+        AZ::IO::SystemFile _file;
+        AZ::u32 _sampleRate = 0;
+        AZ::u16 _channelCount = 0;
+        AZ::u16 _bitsPerSample = 0;
+        bool _isFloat = false;
+        AZ::u64 _dataSize = 0;
+    };
+} // namespace Audio
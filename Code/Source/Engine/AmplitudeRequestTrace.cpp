@@ -0,0 +1,1038 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <Engine/AmplitudeRequestTrace.h>
+
+namespace Audio
+{
+    static constexpr char kTraceMagic[4] = { 'A', 'M', 'T', 'R' };
+    static constexpr AZ::u8 kTraceVersion = 2;
+    static constexpr size_t kTraceHeaderSize = sizeof(kTraceMagic) + sizeof(kTraceVersion);
+
+    // Records are handed to the writer thread by blocks of this size.
+    static constexpr size_t kFlushSize = 64 * 1024;
+
+    // The writer thread wakes up at this interval to write the pending records, if no block filled up before.
+    static constexpr AZStd::chrono::milliseconds kWriteInterval(250);
+
+    // Keeps the objects of the replay away from the IDs given by the ATL, and from the offline renders.
+    static constexpr AZ::u64 kReplayObjectIdBase = AZ::u64(1) << 61;
+
+    static void ResolvePath(const AZStd::string& path, char (&resolvedPath)[AZ_MAX_PATH_LEN])
+    {
+        if (AZ::IO::FileIOBase::GetInstance() == nullptr ||
+            !AZ::IO::FileIOBase::GetInstance()->ResolvePath(path.c_str(), resolvedPath, AZ_MAX_PATH_LEN))
+        {
+            azstrcpy(resolvedPath, AZ_MAX_PATH_LEN, path.c_str());
+        }
+    }
+
+    static void WriteVarUInt(AZStd::vector<AZ::u8>& out, AZ::u64 value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<AZ::u8>(value | 0x80));
+            value >>= 7;
+        }
+
+        out.push_back(static_cast<AZ::u8>(value));
+    }
+
+    static void WriteFloat(AZStd::vector<AZ::u8>& out, const float value)
+    {
+        AZ::u8 bytes[sizeof(float)];
+        memcpy(bytes, &value, sizeof(float));
+        out.insert(out.end(), bytes, bytes + sizeof(float));
+    }
+
+    static void WriteVector(AZStd::vector<AZ::u8>& out, const AZ::Vector3& value)
+    {
+        WriteFloat(out, value.GetX());
+        WriteFloat(out, value.GetY());
+        WriteFloat(out, value.GetZ());
+    }
+
+    static AZ::u64 GetObjectId(const IATLAudioObjectData* const audioObjectData)
+    {
+        const auto* const implObjectData = dynamic_cast<const SATLAudioObjectData_Amplitude*>(audioObjectData);
+        return implObjectData ? implObjectData->nAmID : kAmInvalidObjectId;
+    }
+
+    static void SetWorldPosition(SAmplitudeTraceRequest& request, const SATLWorldPosition& worldPosition)
+    {
+        request.vPosition = worldPosition.GetPositionVec();
+        request.vForward = worldPosition.GetForwardVec();
+        request.vUp = worldPosition.GetUpVec();
+    }
+
+    static SATLWorldPosition GetWorldPosition(const SAmplitudeTraceRequest& request)
+    {
+        const AZ::Vector3 right = request.vForward.Cross(request.vUp);
+        const AZ::Matrix3x3 rotation = AZ::Matrix3x3::CreateFromColumns(right, request.vForward, request.vUp);
+
+        return SATLWorldPosition(AZ::Transform::CreateFromMatrix3x3AndTranslation(rotation, request.vPosition));
+    }
+
+    AmplitudeRequestRecorder::~AmplitudeRequestRecorder()
+    {
+        Close();
+    }
+
+    bool AmplitudeRequestRecorder::Open(const AZStd::string& path)
+    {
+        Close();
+
+        char resolvedPath[AZ_MAX_PATH_LEN] = { 0 };
+        ResolvePath(path, resolvedPath);
+
+        constexpr int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+
+        if (!_file.Open(resolvedPath, openMode))
+        {
+            AZLOG_ERROR("[Amplitude] Unable to create the request trace '%s'.", resolvedPath);
+            return false;
+        }
+
+        _buffer.clear();
+        _buffer.reserve(kFlushSize + 256);
+        _buffer.insert(_buffer.end(), kTraceMagic, kTraceMagic + sizeof(kTraceMagic));
+        _buffer.push_back(kTraceVersion);
+
+        _pending.clear();
+        _pending.reserve(kFlushSize + 256);
+
+        _lastRequestTime = AZStd::chrono::steady_clock::now();
+        _requestCount = 0;
+        _isRunning = true;
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Amplitude Request Capture";
+
+        _writerThread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                WriterThread();
+            });
+
+        return true;
+    }
+
+    void AmplitudeRequestRecorder::Close()
+    {
+        if (!_isRunning)
+        {
+            return;
+        }
+
+        Flush();
+
+        {
+            AZStd::scoped_lock lock(_pendingMutex);
+            _isRunning = false;
+        }
+
+        _wakeUp.notify_one();
+        _writerThread.join();
+
+        _file.Close();
+    }
+
+    void AmplitudeRequestRecorder::RecordUpdate(const float updateIntervalMs)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_UPDATE;
+        request.fValues[0] = updateIntervalMs;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordRegisterObject(const IATLAudioObjectData* const audioObjectData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_REGISTER_OBJECT;
+        request.nObjectID = GetObjectId(audioObjectData);
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordUnregisterObject(const IATLAudioObjectData* const audioObjectData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_UNREGISTER_OBJECT;
+        request.nObjectID = GetObjectId(audioObjectData);
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordActivateTrigger(
+        const IATLAudioObjectData* const audioObjectData,
+        const IATLTriggerImplData* const triggerData,
+        const IATLEventData* const eventData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implTriggerData = dynamic_cast<const SATLTriggerImplData_Amplitude*>(triggerData);
+        const auto* const implEventData = dynamic_cast<const SATLEventData_Amplitude*>(eventData);
+
+        if (implTriggerData == nullptr || implEventData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_ACTIVATE_TRIGGER;
+        request.nObjectID = GetObjectId(audioObjectData);
+        request.nEventID = implEventData->nATLID;
+        request.nAmID = implTriggerData->nAmID;
+        request.nValue = implTriggerData->nMaxInstances;
+        request.fValues[0] = implTriggerData->fPriority;
+        request.fValues[1] = static_cast<float>(implTriggerData->fCoalescingWindow);
+        request.fValues[2] = static_cast<float>(implTriggerData->fDuration);
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordStopEvent(const IATLAudioObjectData* const audioObjectData, const IATLEventData* const eventData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implEventData = dynamic_cast<const SATLEventData_Amplitude*>(eventData);
+        if (implEventData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_STOP_EVENT;
+        request.nObjectID = GetObjectId(audioObjectData);
+        request.nEventID = implEventData->nATLID;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordSetPosition(
+        const IATLAudioObjectData* const audioObjectData, const SATLWorldPosition& worldPosition)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_SET_POSITION;
+        request.nObjectID = GetObjectId(audioObjectData);
+        SetWorldPosition(request, worldPosition);
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordSetEnvironment(
+        const IATLAudioObjectData* const audioObjectData, const IATLEnvironmentImplData* const environmentData, const float amount)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implEnvironmentData = dynamic_cast<const SATLEnvironmentImplData_Amplitude*>(environmentData);
+        if (implEnvironmentData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_SET_ENVIRONMENT;
+        request.nObjectID = GetObjectId(audioObjectData);
+        request.nValue = implEnvironmentData->eType;
+        request.nAmID = implEnvironmentData->nAmEnvID;
+        request.nAmStateID = implEnvironmentData->nAmStateID;
+        request.fValues[0] = amount;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordSetRtpc(
+        const IATLAudioObjectData* const audioObjectData, const IATLRtpcImplData* const rtpcData, const float value)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implRtpcData = dynamic_cast<const SATLRtpcImplData_Amplitude*>(rtpcData);
+        if (implRtpcData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_SET_RTPC;
+        request.nObjectID = GetObjectId(audioObjectData);
+        request.nAmID = implRtpcData->nAmID;
+        request.fValues[0] = value;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordSetSwitchState(
+        const IATLAudioObjectData* const audioObjectData, const IATLSwitchStateImplData* const switchStateData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implSwitchData = dynamic_cast<const SATLSwitchStateImplData_Amplitude*>(switchStateData);
+        if (implSwitchData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_SET_SWITCH_STATE;
+        request.nObjectID = GetObjectId(audioObjectData);
+        request.nAmID = implSwitchData->nAmSwitchID;
+        request.nAmStateID = implSwitchData->nAmStateID;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordSetObstructionOcclusion(
+        const IATLAudioObjectData* const audioObjectData, const float obstruction, const float occlusion)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_SET_OBSTRUCTION_OCCLUSION;
+        request.nObjectID = GetObjectId(audioObjectData);
+        request.fValues[0] = obstruction;
+        request.fValues[1] = occlusion;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordSetListenerPosition(
+        const IATLListenerData* const listenerData, const SATLWorldPosition& newPosition)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implListenerData = dynamic_cast<const SATLListenerData_Amplitude*>(listenerData);
+        if (implListenerData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_SET_LISTENER_POSITION;
+        request.nObjectID = implListenerData->nAmListenerObjectId;
+        SetWorldPosition(request, newPosition);
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordRegisterBank(const SATLAudioFileEntryInfo* const audioFileEntry)
+    {
+        if (!IsOpen() || audioFileEntry == nullptr || audioFileEntry->sFileName == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_REGISTER_BANK;
+        request.sName = audioFileEntry->sFileName;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordUnregisterBank(const SATLAudioFileEntryInfo* const audioFileEntry)
+    {
+        if (!IsOpen() || audioFileEntry == nullptr || audioFileEntry->sFileName == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_UNREGISTER_BANK;
+        request.sName = audioFileEntry->sFileName;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordResetRtpc(
+        const IATLAudioObjectData* const audioObjectData, const IATLRtpcImplData* const rtpcData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implRtpcData = dynamic_cast<const SATLRtpcImplData_Amplitude*>(rtpcData);
+        if (implRtpcData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_RESET_RTPC;
+        request.nObjectID = GetObjectId(audioObjectData);
+        request.nAmID = implRtpcData->nAmID;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordRegisterListener(const IATLListenerData* const listenerData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implListenerData = dynamic_cast<const SATLListenerData_Amplitude*>(listenerData);
+        if (implListenerData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_REGISTER_LISTENER;
+        request.nObjectID = implListenerData->nAmListenerObjectId;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::RecordUnregisterListener(const IATLListenerData* const listenerData)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        const auto* const implListenerData = dynamic_cast<const SATLListenerData_Amplitude*>(listenerData);
+        if (implListenerData == nullptr)
+        {
+            return;
+        }
+
+        SAmplitudeTraceRequest request;
+        request.eType = eATR_UNREGISTER_LISTENER;
+        request.nObjectID = implListenerData->nAmListenerObjectId;
+        Write(request);
+    }
+
+    void AmplitudeRequestRecorder::Write(const SAmplitudeTraceRequest& request)
+    {
+        const auto now = AZStd::chrono::steady_clock::now();
+        const auto elapsed = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - _lastRequestTime);
+
+        // Only whole microseconds are consumed, so that rounding errors don't accumulate over long captures.
+        _lastRequestTime += elapsed;
+
+        _buffer.push_back(request.eType);
+        WriteVarUInt(_buffer, static_cast<AZ::u64>(elapsed.count()));
+
+        switch (request.eType)
+        {
+        case eATR_UPDATE:
+            WriteFloat(_buffer, request.fValues[0]);
+            break;
+        case eATR_REGISTER_OBJECT:
+        case eATR_UNREGISTER_OBJECT:
+            WriteVarUInt(_buffer, request.nObjectID);
+            break;
+        case eATR_ACTIVATE_TRIGGER:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteVarUInt(_buffer, request.nEventID);
+            WriteVarUInt(_buffer, request.nAmID);
+            WriteVarUInt(_buffer, request.nValue);
+            WriteFloat(_buffer, request.fValues[0]);
+            WriteFloat(_buffer, request.fValues[1]);
+            WriteFloat(_buffer, request.fValues[2]);
+            break;
+        case eATR_STOP_EVENT:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteVarUInt(_buffer, request.nEventID);
+            break;
+        case eATR_SET_POSITION:
+        case eATR_SET_LISTENER_POSITION:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteVector(_buffer, request.vPosition);
+            WriteVector(_buffer, request.vForward);
+            WriteVector(_buffer, request.vUp);
+            break;
+        case eATR_SET_ENVIRONMENT:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteVarUInt(_buffer, request.nValue);
+            WriteVarUInt(_buffer, request.nAmID);
+            WriteVarUInt(_buffer, request.nAmStateID);
+            WriteFloat(_buffer, request.fValues[0]);
+            break;
+        case eATR_SET_RTPC:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteVarUInt(_buffer, request.nAmID);
+            WriteFloat(_buffer, request.fValues[0]);
+            break;
+        case eATR_SET_SWITCH_STATE:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteVarUInt(_buffer, request.nAmID);
+            WriteVarUInt(_buffer, request.nAmStateID);
+            break;
+        case eATR_SET_OBSTRUCTION_OCCLUSION:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteFloat(_buffer, request.fValues[0]);
+            WriteFloat(_buffer, request.fValues[1]);
+            break;
+        case eATR_REGISTER_BANK:
+        case eATR_UNREGISTER_BANK:
+            WriteVarUInt(_buffer, request.sName.size());
+            _buffer.insert(_buffer.end(), request.sName.begin(), request.sName.end());
+            break;
+        case eATR_RESET_RTPC:
+            WriteVarUInt(_buffer, request.nObjectID);
+            WriteVarUInt(_buffer, request.nAmID);
+            break;
+        case eATR_REGISTER_LISTENER:
+        case eATR_UNREGISTER_LISTENER:
+            WriteVarUInt(_buffer, request.nObjectID);
+            break;
+        default:
+            break;
+        }
+
+        ++_requestCount;
+
+        if (_buffer.size() >= kFlushSize)
+        {
+            Flush();
+        }
+    }
+
+    void AmplitudeRequestRecorder::Flush()
+    {
+        AZ_PROFILE_SCOPE(Audio, "Amplitude::RequestRecorder::Flush");
+
+        if (_buffer.empty())
+        {
+            return;
+        }
+
+        {
+            AZStd::scoped_lock lock(_pendingMutex);
+
+            // Swapping keeps both allocations alive, so recording doesn't allocate once both have grown.
+            if (_pending.empty())
+            {
+                _pending.swap(_buffer);
+            }
+            else
+            {
+                _pending.insert(_pending.end(), _buffer.begin(), _buffer.end());
+            }
+        }
+
+        _buffer.clear();
+        _wakeUp.notify_one();
+    }
+
+    void AmplitudeRequestRecorder::WriterThread()
+    {
+        AZStd::vector<AZ::u8> records;
+        records.reserve(kFlushSize + 256);
+
+        bool isRunning = true;
+        while (isRunning)
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(_pendingMutex);
+                _wakeUp.wait_for(
+                    lock,
+                    kWriteInterval,
+                    [this]()
+                    {
+                        return !_isRunning || !_pending.empty();
+                    });
+
+                records.swap(_pending);
+                isRunning = _isRunning;
+            }
+
+            if (!records.empty())
+            {
+                AZ_PROFILE_SCOPE(Audio, "Amplitude::RequestRecorder::Write");
+
+                _file.Write(records.data(), records.size());
+                records.clear();
+            }
+        }
+    }
+
+    bool AmplitudeRequestTraceReader::Open(const AZStd::string& path)
+    {
+        _data.clear();
+        _offset = 0;
+        _time = 0;
+
+        char resolvedPath[AZ_MAX_PATH_LEN] = { 0 };
+        ResolvePath(path, resolvedPath);
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(resolvedPath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZLOG_ERROR("[Amplitude] Unable to open the request trace '%s'.", resolvedPath);
+            return false;
+        }
+
+        _data.resize(file.Length());
+        const bool isRead = file.Read(_data.size(), _data.data()) == _data.size();
+        file.Close();
+
+        if (!isRead || _data.size() < kTraceHeaderSize || memcmp(_data.data(), kTraceMagic, sizeof(kTraceMagic)) != 0)
+        {
+            AZLOG_ERROR("[Amplitude] '%s' is not a request trace.", resolvedPath);
+            _data.clear();
+            return false;
+        }
+
+        if (_data[sizeof(kTraceMagic)] != kTraceVersion)
+        {
+            AZLOG_ERROR(
+                "[Amplitude] The request trace '%s' has version %u, expected %u.", resolvedPath, _data[sizeof(kTraceMagic)], kTraceVersion);
+            _data.clear();
+            return false;
+        }
+
+        _offset = kTraceHeaderSize;
+        return true;
+    }
+
+    bool AmplitudeRequestTraceReader::Read(SAmplitudeTraceRequest& request)
+    {
+        if (_offset >= _data.size())
+        {
+            return false;
+        }
+
+        const AZ::u8 type = _data[_offset++];
+        if (type >= eATR_COUNT)
+        {
+            AZLOG_ERROR("[Amplitude] Unknown request type %u in the request trace, the replay is stopped.", type);
+            _offset = _data.size();
+            return false;
+        }
+
+        AZ::u64 deltaTime = 0;
+        AZ::u64 value = 0;
+        bool isValid = ReadVarUInt(deltaTime);
+
+        request.eType = static_cast<EAmplitudeTraceRequestType>(type);
+        request.nTimeUs = _time += deltaTime;
+
+        switch (request.eType)
+        {
+        case eATR_UPDATE:
+            isValid = isValid && ReadFloat(request.fValues[0]);
+            break;
+        case eATR_REGISTER_OBJECT:
+        case eATR_UNREGISTER_OBJECT:
+            isValid = isValid && ReadVarUInt(request.nObjectID);
+            break;
+        case eATR_ACTIVATE_TRIGGER:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadVarUInt(request.nEventID) && ReadVarUInt(request.nAmID) &&
+                ReadVarUInt(value) && ReadFloat(request.fValues[0]) && ReadFloat(request.fValues[1]) && ReadFloat(request.fValues[2]);
+            request.nValue = static_cast<AZ::u32>(value);
+            break;
+        case eATR_STOP_EVENT:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadVarUInt(request.nEventID);
+            break;
+        case eATR_SET_POSITION:
+        case eATR_SET_LISTENER_POSITION:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadVector(request.vPosition) && ReadVector(request.vForward) &&
+                ReadVector(request.vUp);
+            break;
+        case eATR_SET_ENVIRONMENT:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadVarUInt(value) && ReadVarUInt(request.nAmID) &&
+                ReadVarUInt(request.nAmStateID) && ReadFloat(request.fValues[0]);
+            request.nValue = static_cast<AZ::u32>(value);
+            break;
+        case eATR_SET_RTPC:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadVarUInt(request.nAmID) && ReadFloat(request.fValues[0]);
+            break;
+        case eATR_SET_SWITCH_STATE:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadVarUInt(request.nAmID) && ReadVarUInt(request.nAmStateID);
+            break;
+        case eATR_SET_OBSTRUCTION_OCCLUSION:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadFloat(request.fValues[0]) && ReadFloat(request.fValues[1]);
+            break;
+        case eATR_REGISTER_BANK:
+        case eATR_UNREGISTER_BANK:
+            isValid = isValid && ReadVarUInt(value) && value <= _data.size() - _offset;
+            if (isValid)
+            {
+                request.sName.assign(reinterpret_cast<const char*>(_data.data() + _offset), static_cast<size_t>(value));
+                _offset += static_cast<size_t>(value);
+            }
+            break;
+        case eATR_RESET_RTPC:
+            isValid = isValid && ReadVarUInt(request.nObjectID) && ReadVarUInt(request.nAmID);
+            break;
+        case eATR_REGISTER_LISTENER:
+        case eATR_UNREGISTER_LISTENER:
+            isValid = isValid && ReadVarUInt(request.nObjectID);
+            break;
+        default:
+            break;
+        }
+
+        if (!isValid)
+        {
+            AZLOG_WARN("[Amplitude] The request trace is truncated, the replay is stopped.");
+            _offset = _data.size();
+        }
+
+        return isValid;
+    }
+
+    bool AmplitudeRequestTraceReader::ReadVarUInt(AZ::u64& value)
+    {
+        value = 0;
+
+        for (AZ::u32 shift = 0; shift < 64 && _offset < _data.size(); shift += 7)
+        {
+            const AZ::u8 byte = _data[_offset++];
+            value |= static_cast<AZ::u64>(byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool AmplitudeRequestTraceReader::ReadFloat(float& value)
+    {
+        if (_data.size() - _offset < sizeof(float))
+        {
+            return false;
+        }
+
+        memcpy(&value, _data.data() + _offset, sizeof(float));
+        _offset += sizeof(float);
+        return true;
+    }
+
+    bool AmplitudeRequestTraceReader::ReadVector(AZ::Vector3& value)
+    {
+        float x, y, z;
+        if (!ReadFloat(x) || !ReadFloat(y) || !ReadFloat(z))
+        {
+            return false;
+        }
+
+        value.Set(x, y, z);
+        return true;
+    }
+
+    bool AmplitudeRequestReplayer::Start(const AZStd::string& path, const float speed)
+    {
+        if (_isRunning)
+        {
+            AZLOG_WARN("[Amplitude] A request trace is already being replayed.");
+            return false;
+        }
+
+        if (!_reader.Open(path))
+        {
+            return false;
+        }
+
+        _hasNext = false;
+        _speed = AZStd::max(speed, 0.0f);
+        _timeUs = 0.0;
+        _requestCount = 0;
+        _isRunning = true;
+
+        return true;
+    }
+
+    void AmplitudeRequestReplayer::Stop(IAudioSystemImplementation* const implementation)
+    {
+        if (!_isRunning)
+        {
+            return;
+        }
+
+        Release(implementation);
+
+        _reader = AmplitudeRequestTraceReader();
+        _hasNext = false;
+        _isRunning = false;
+    }
+
+    bool AmplitudeRequestReplayer::Advance(IAudioSystemImplementation* const implementation, const float updateIntervalMs)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        _timeUs += static_cast<double>(updateIntervalMs) * 1000.0 * _speed;
+
+        while (true)
+        {
+            if (!_hasNext)
+            {
+                _hasNext = _reader.Read(_next);
+                if (!_hasNext)
+                {
+                    return false;
+                }
+            }
+
+            if (static_cast<double>(_next.nTimeUs) > _timeUs)
+            {
+                return true;
+            }
+
+            // The live updates drive the engine, the recorded ones only mark time.
+            if (_next.eType != eATR_UPDATE)
+            {
+                Dispatch(implementation, _next);
+            }
+
+            _hasNext = false;
+        }
+    }
+
+    void AmplitudeRequestReplayer::Run(IAudioSystemImplementation* const implementation, const AZStd::function<void(float)>& updateFrame)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        SAmplitudeTraceRequest request;
+        while (_reader.Read(request))
+        {
+            if (request.eType == eATR_UPDATE)
+            {
+                updateFrame(request.fValues[0]);
+            }
+            else
+            {
+                Dispatch(implementation, request);
+            }
+        }
+    }
+
+    void AmplitudeRequestReplayer::Dispatch(IAudioSystemImplementation* const implementation, const SAmplitudeTraceRequest& request)
+    {
+        ++_requestCount;
+
+        switch (request.eType)
+        {
+        case eATR_REGISTER_OBJECT:
+            {
+                GetObject(implementation, request.nObjectID);
+                break;
+            }
+        case eATR_UNREGISTER_OBJECT:
+            {
+                // The global object lives as long as the implementation.
+                if (const auto it = _objects.find(request.nObjectID); it != _objects.end() && request.nObjectID != GLOBAL_AUDIO_OBJECT_ID)
+                {
+                    implementation->UnregisterAudioObject(it->second);
+                    implementation->DeleteAudioObjectData(it->second);
+                    _objects.erase(it);
+                }
+                break;
+            }
+        case eATR_ACTIVATE_TRIGGER:
+            {
+                // The ATL recycles its event IDs once events are done, the replay does the same with their data.
+                SATLEventData_Amplitude*& eventData = _events[request.nEventID];
+                if (eventData == nullptr)
+                {
+                    eventData = static_cast<SATLEventData_Amplitude*>(implementation->NewAudioEventData(request.nEventID));
+                }
+                else
+                {
+                    implementation->ResetAudioEventData(eventData);
+                }
+
+                const SATLTriggerImplData_Amplitude triggerData(
+                    request.nAmID, request.fValues[0], request.fValues[1], request.nValue, request.fValues[2]);
+                implementation->ActivateTrigger(GetObject(implementation, request.nObjectID), &triggerData, eventData, nullptr);
+                break;
+            }
+        case eATR_STOP_EVENT:
+            {
+                if (const auto it = _events.find(request.nEventID); it != _events.end())
+                {
+                    implementation->StopEvent(GetObject(implementation, request.nObjectID), it->second);
+                }
+                break;
+            }
+        case eATR_SET_POSITION:
+            {
+                implementation->SetPosition(GetObject(implementation, request.nObjectID), GetWorldPosition(request));
+                break;
+            }
+        case eATR_SET_ENVIRONMENT:
+            {
+                const SATLEnvironmentImplData_Amplitude environmentData(
+                    static_cast<EAmplitudeAudioEnvironmentType>(request.nValue), request.nAmID, request.nAmStateID);
+                implementation->SetEnvironment(GetObject(implementation, request.nObjectID), &environmentData, request.fValues[0]);
+                break;
+            }
+        case eATR_SET_RTPC:
+            {
+                const SATLRtpcImplData_Amplitude rtpcData(request.nAmID);
+                implementation->SetRtpc(GetObject(implementation, request.nObjectID), &rtpcData, request.fValues[0]);
+                break;
+            }
+        case eATR_SET_SWITCH_STATE:
+            {
+                const SATLSwitchStateImplData_Amplitude switchStateData(request.nAmID, request.nAmStateID);
+                implementation->SetSwitchState(GetObject(implementation, request.nObjectID), &switchStateData);
+                break;
+            }
+        case eATR_SET_OBSTRUCTION_OCCLUSION:
+            {
+                implementation->SetObstructionOcclusion(
+                    GetObject(implementation, request.nObjectID), request.fValues[0], request.fValues[1]);
+                break;
+            }
+        case eATR_SET_LISTENER_POSITION:
+            {
+                if (const auto it = _listeners.find(request.nObjectID); it != _listeners.end())
+                {
+                    implementation->SetListenerPosition(it->second, GetWorldPosition(request));
+                    break;
+                }
+
+                // Listeners registered before the capture started are expected to exist.
+                SATLListenerData_Amplitude listenerData(request.nObjectID);
+                implementation->SetListenerPosition(&listenerData, GetWorldPosition(request));
+                break;
+            }
+        case eATR_RESET_RTPC:
+            {
+                const SATLRtpcImplData_Amplitude rtpcData(request.nAmID);
+                implementation->ResetRtpc(GetObject(implementation, request.nObjectID), &rtpcData);
+                break;
+            }
+        case eATR_REGISTER_LISTENER:
+            {
+                // Default listeners are replayed as regular ones, the default listener of the game is kept.
+                if (_listeners.find(request.nObjectID) == _listeners.end())
+                {
+                    auto* const listenerData = static_cast<SATLListenerData_Amplitude*>(
+                        implementation->NewAudioListenerObjectData(static_cast<TATLIDType>(kReplayObjectIdBase + request.nObjectID)));
+                    _listeners.emplace(request.nObjectID, listenerData);
+                }
+                break;
+            }
+        case eATR_UNREGISTER_LISTENER:
+            {
+                if (const auto it = _listeners.find(request.nObjectID); it != _listeners.end())
+                {
+                    implementation->DeleteAudioListenerObjectData(it->second);
+                    _listeners.erase(it);
+                }
+                break;
+            }
+        case eATR_REGISTER_BANK:
+        case eATR_UNREGISTER_BANK:
+        default:
+            break;
+        }
+    }
+
+    SATLAudioObjectData_Amplitude* AmplitudeRequestReplayer::GetObject(
+        IAudioSystemImplementation* const implementation, const AZ::u64 objectId)
+    {
+        auto it = _objects.find(objectId);
+        if (it == _objects.end())
+        {
+            SATLAudioObjectData_Amplitude* objectData;
+
+            // The global object is registered by the implementation itself. Objects registered before the capture
+            // started are created by the first request using them.
+            if (objectId == GLOBAL_AUDIO_OBJECT_ID)
+            {
+                objectData = static_cast<SATLAudioObjectData_Amplitude*>(implementation->NewGlobalAudioObjectData(objectId));
+            }
+            else
+            {
+                objectData = static_cast<SATLAudioObjectData_Amplitude*>(
+                    implementation->NewAudioObjectData(static_cast<TAudioObjectID>(kReplayObjectIdBase + objectId)));
+                implementation->RegisterAudioObject(objectData, nullptr);
+            }
+
+            it = _objects.emplace(objectId, objectData).first;
+        }
+
+        return it->second;
+    }
+
+    void AmplitudeRequestReplayer::Release(IAudioSystemImplementation* const implementation)
+    {
+        // Events are stopped before being deleted, the voice limiter may still reference them.
+        for (const auto& event : _events)
+        {
+            if (event.second->audioEventState == eAES_PLAYING)
+            {
+                implementation->StopEvent(nullptr, event.second);
+            }
+
+            implementation->DeleteAudioEventData(event.second);
+        }
+
+        for (const auto& object : _objects)
+        {
+            if (object.first != GLOBAL_AUDIO_OBJECT_ID)
+            {
+                implementation->UnregisterAudioObject(object.second);
+            }
+
+            implementation->DeleteAudioObjectData(object.second);
+        }
+
+        for (const auto& listener : _listeners)
+        {
+            implementation->DeleteAudioListenerObjectData(listener.second);
+        }
+
+        _events.clear();
+        _objects.clear();
+        _listeners.clear();
+    }
+} // namespace Audio
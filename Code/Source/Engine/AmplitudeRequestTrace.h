@@ -0,0 +1,233 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <IAudioSystemImplementation.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+#include <Engine/ATLEntities_amplitude.h>
+
+namespace Audio
+{
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    enum EAmplitudeTraceRequestType : AZ::u8
+    {
+        eATR_UPDATE = 0, // fValues[0]: update interval in milliseconds.
+        eATR_REGISTER_OBJECT = 1,
+        eATR_UNREGISTER_OBJECT = 2,
+        eATR_ACTIVATE_TRIGGER = 3, // nEventID, nAmID, nValue: max instances, fValues: priority, coalescing window, duration.
+        eATR_STOP_EVENT = 4, // nEventID.
+        eATR_SET_POSITION = 5, // vPosition, vForward, vUp.
+        eATR_SET_ENVIRONMENT = 6, // nValue: environment type, nAmID, nAmStateID, fValues[0]: amount.
+        eATR_SET_RTPC = 7, // nAmID, fValues[0]: value.
+        eATR_SET_SWITCH_STATE = 8, // nAmID, nAmStateID.
+        eATR_SET_OBSTRUCTION_OCCLUSION = 9, // fValues: obstruction and occlusion.
+        eATR_SET_LISTENER_POSITION = 10, // nObjectID is the listener, vPosition, vForward, vUp.
+        eATR_REGISTER_BANK = 11, // sName: soundbank file.
+        eATR_UNREGISTER_BANK = 12, // sName: soundbank file.
+        eATR_RESET_RTPC = 13, // nAmID.
+        eATR_REGISTER_LISTENER = 14, // nObjectID is the listener.
+        eATR_UNREGISTER_LISTENER = 15, // nObjectID is the listener.
+
+        eATR_COUNT
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! One call to the Amplitude implementation, as stored in a request trace.
+    struct SAmplitudeTraceRequest
+    {
+        EAmplitudeTraceRequestType eType = eATR_UPDATE;
+
+        // Time of the call, since the start of the capture.
+        AZ::u64 nTimeUs = 0;
+
+        // Amplitude entity of the audio object, or Amplitude listener.
+        AZ::u64 nObjectID = 0;
+        AZ::u64 nEventID = 0;
+        AZ::u64 nAmID = 0;
+        AZ::u64 nAmStateID = 0;
+        AZ::u32 nValue = 0;
+        float fValues[3] = { 0.0f, 0.0f, 0.0f };
+        AZ::Vector3 vPosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 vForward = AZ::Vector3::CreateAxisY();
+        AZ::Vector3 vUp = AZ::Vector3::CreateAxisZ();
+        AZStd::string sName;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Records the calls made to the Amplitude implementation into a compact binary trace.
+    //!
+    //! A trace starts with a magic and a version, followed by one record per call: the request type, the time
+    //! elapsed since the previous record in microseconds, and the arguments of the call. Integers are stored as
+    //! variable length integers, and floats as raw 32-bit values. Records are buffered, and handed by blocks to a
+    //! writer thread, so the capture only costs a few bytes of copy per call and never waits on the disk.
+    //!
+    //! Known gaps: SetMultiplePositions is not supported by the implementation and is not recorded. Panning mode
+    //! and tier changes, and audio input sources, are not requests of the implementation and are not recorded
+    //! either, so a replay uses the current panning settings, and triggers playing an audio input source are
+    //! replayed without it.
+    class AmplitudeRequestRecorder
+    {
+    public:
+        ~AmplitudeRequestRecorder();
+
+        //! Creates the trace file, overwriting any existing one. The path can contain file IO aliases.
+        bool Open(const AZStd::string& path);
+
+        //! Writes the pending records, stops the writer thread, and closes the file.
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const
+        {
+            return _isRunning;
+        }
+
+        [[nodiscard]] AZ::u64 GetRequestCount() const
+        {
+            return _requestCount;
+        }
+
+        void RecordUpdate(float updateIntervalMs);
+        void RecordRegisterObject(const IATLAudioObjectData* audioObjectData);
+        void RecordUnregisterObject(const IATLAudioObjectData* audioObjectData);
+        void RecordActivateTrigger(
+            const IATLAudioObjectData* audioObjectData, const IATLTriggerImplData* triggerData, const IATLEventData* eventData);
+        void RecordStopEvent(const IATLAudioObjectData* audioObjectData, const IATLEventData* eventData);
+        void RecordSetPosition(const IATLAudioObjectData* audioObjectData, const SATLWorldPosition& worldPosition);
+        void RecordSetEnvironment(
+            const IATLAudioObjectData* audioObjectData, const IATLEnvironmentImplData* environmentData, float amount);
+        void RecordSetRtpc(const IATLAudioObjectData* audioObjectData, const IATLRtpcImplData* rtpcData, float value);
+        void RecordSetSwitchState(const IATLAudioObjectData* audioObjectData, const IATLSwitchStateImplData* switchStateData);
+        void RecordSetObstructionOcclusion(const IATLAudioObjectData* audioObjectData, float obstruction, float occlusion);
+        void RecordSetListenerPosition(const IATLListenerData* listenerData, const SATLWorldPosition& newPosition);
+        void RecordRegisterBank(const SATLAudioFileEntryInfo* audioFileEntry);
+        void RecordUnregisterBank(const SATLAudioFileEntryInfo* audioFileEntry);
+        void RecordResetRtpc(const IATLAudioObjectData* audioObjectData, const IATLRtpcImplData* rtpcData);
+        void RecordRegisterListener(const IATLListenerData* listenerData);
+        void RecordUnregisterListener(const IATLListenerData* listenerData);
+
+    private:
+        void Write(const SAmplitudeTraceRequest& request);
+
+        //! Hands the buffered records to the writer thread.
+        void Flush();
+
+        void WriterThread();
+
+        AZStd::vector<AZ::u8> _buffer;
+        AZStd::chrono::steady_clock::time_point _lastRequestTime;
+        AZ::u64 _requestCount = 0;
+
+        AZStd::mutex _pendingMutex;
+        AZStd::condition_variable _wakeUp;
+        AZStd::vector<AZ::u8> _pending;
+
+        AZStd::atomic_bool _isRunning{ false };
+        AZStd::thread _writerThread;
+
+        // Only used by the writer thread while it runs.
+        AZ::IO::SystemFile _file;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Reads the records of a request trace, in order.
+    class AmplitudeRequestTraceReader
+    {
+    public:
+        //! Loads the whole trace in memory. Records are decoded on demand by Read().
+        bool Open(const AZStd::string& path);
+
+        //! Decodes the next record.
+        //! @return false at the end of the trace, or if the trace is truncated.
+        bool Read(SAmplitudeTraceRequest& request);
+
+    private:
+        bool ReadVarUInt(AZ::u64& value);
+        bool ReadFloat(float& value);
+        bool ReadVector(AZ::Vector3& value);
+
+        AZStd::vector<AZ::u8> _data;
+        size_t _offset = 0;
+        AZ::u64 _time = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Re-drives an Amplitude implementation from a request trace.
+    //!
+    //! Audio objects and events of the trace are created on the fly, with IDs away from the ones given by the
+    //! ATL. Listeners registered during the capture are created the same way, the others are expected to exist.
+    //! Soundbanks are not loaded by the replay, the banks of the trace are expected to be already loaded.
+    //! A replay is either paced, with Advance() called on each audio update and the recorded updates skipped, or
+    //! runs as fast as possible with Run(), which calls back for each recorded update.
+    class AmplitudeRequestReplayer
+    {
+    public:
+        //! Loads the trace. A speed of 0 replays the trace as fast as possible.
+        bool Start(const AZStd::string& path, float speed);
+
+        //! Stops the events, and releases the objects created by the replay.
+        void Stop(IAudioSystemImplementation* implementation);
+
+        [[nodiscard]] bool IsRunning() const
+        {
+            return _isRunning;
+        }
+
+        [[nodiscard]] bool IsPaced() const
+        {
+            return _speed > 0.0f;
+        }
+
+        //! Replays the requests of the next updateIntervalMs milliseconds, scaled by the replay speed.
+        //! @return false once the end of the trace has been reached.
+        bool Advance(IAudioSystemImplementation* implementation, float updateIntervalMs);
+
+        //! Replays the whole trace, calling updateFrame with the interval of each recorded update.
+        void Run(IAudioSystemImplementation* implementation, const AZStd::function<void(float)>& updateFrame);
+
+        [[nodiscard]] AZ::u64 GetRequestCount() const
+        {
+            return _requestCount;
+        }
+
+    private:
+        void Dispatch(IAudioSystemImplementation* implementation, const SAmplitudeTraceRequest& request);
+        SATLAudioObjectData_Amplitude* GetObject(IAudioSystemImplementation* implementation, AZ::u64 objectId);
+        void Release(IAudioSystemImplementation* implementation);
+
+        AmplitudeRequestTraceReader _reader;
+        SAmplitudeTraceRequest _next;
+        bool _hasNext = false;
+        bool _isRunning = false;
+        float _speed = 1.0f;
+        double _timeUs = 0.0;
+        AZ::u64 _requestCount = 0;
+
+        AZStd::unordered_map<AZ::u64, SATLAudioObjectData_Amplitude*> _objects;
+        AZStd::unordered_map<AZ::u64, SATLEventData_Amplitude*> _events;
+        AZStd::unordered_map<AZ::u64, SATLListenerData_Amplitude*> _listeners;
+    };
+} // namespace Audio
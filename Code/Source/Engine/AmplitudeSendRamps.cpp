@@ -0,0 +1,188 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
+#include <Engine/AmplitudeSendRamps.h>
+
+namespace Audio
+{
+    // Sends closer than this to the last applied value are not sent to Amplitude again, unless the ramp is done.
+    static constexpr float kSendEpsilon = 0.001f;
+
+    size_t AmplitudeSendRamps::SSendKeyHash::operator()(const SSendKey& key) const
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(hash, key.nAmEntityID, key.nAmEnvironmentID);
+        return hash;
+    }
+
+    AmplitudeSendRamps::AmplitudeSendRamps()
+        : _rampTime(DefaultRampTime)
+    {
+    }
+
+    void AmplitudeSendRamps::SetRampTime(const AmTime rampTime)
+    {
+        _rampTime = AZStd::max(rampTime, 0.0);
+    }
+
+    void AmplitudeSendRamps::SetEnvironmentAmount(const AmEntityID entityId, const AmEnvironmentID environmentId, const float amount)
+    {
+        const SSendKey key{ entityId, environmentId };
+        const float target = AZStd::clamp(amount, 0.0f, 1.0f);
+
+        if (const auto it = _slots.find(key); it != _slots.end())
+        {
+            _target[it->second] = target;
+            return;
+        }
+
+        if (target <= 0.0f)
+        {
+            return;
+        }
+
+        _slots.emplace(key, static_cast<AZ::u32>(_current.size()));
+        _current.push_back(0.0f);
+        _target.push_back(target);
+        _applied.push_back(-1.0f);
+        _keys.push_back(key);
+    }
+
+    void AmplitudeSendRamps::ForgetEntity(const AmEntityID entityId)
+    {
+        for (size_t i = _keys.size(); i > 0; --i)
+        {
+            if (_keys[i - 1].nAmEntityID == entityId)
+            {
+                RemoveSlot(static_cast<AZ::u32>(i - 1));
+            }
+        }
+    }
+
+    void AmplitudeSendRamps::ForgetEntities(const TAmUniqueIDVector& sortedEntityIds)
+    {
+        for (size_t i = _keys.size(); i > 0; --i)
+        {
+            if (AZStd::binary_search(sortedEntityIds.begin(), sortedEntityIds.end(), _keys[i - 1].nAmEntityID))
+            {
+                RemoveSlot(static_cast<AZ::u32>(i - 1));
+            }
+        }
+    }
+
+    void AmplitudeSendRamps::Update(Engine* const engine, const AmplitudeVoiceLimiter& voiceLimiter, const AmTime deltaTime)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        if (_keys.empty())
+        {
+            return;
+        }
+
+        Step(_rampTime > 0.0 ? static_cast<float>(deltaTime / _rampTime) : 1.0f);
+
+        voiceLimiter.GetRealVoiceEntities(_audibleEntities);
+        AZStd::sort(_audibleEntities.begin(), _audibleEntities.end());
+
+        // Walk backwards, finished ramps are swapped with the last slot which has already been visited.
+        for (size_t i = _keys.size(); i > 0; --i)
+        {
+            const size_t slot = i - 1;
+            const SSendKey& key = _keys[slot];
+            const float current = _current[slot];
+
+            if (AZStd::binary_search(_audibleEntities.begin(), _audibleEntities.end(), key.nAmEntityID))
+            {
+                const bool isDone = current == _target[slot] && current != _applied[slot];
+
+                if (isDone || AZ::GetAbs(current - _applied[slot]) >= kSendEpsilon)
+                {
+                    if (Entity entity = engine->GetEntity(key.nAmEntityID); entity.Valid())
+                    {
+                        entity.SetEnvironmentFactor(key.nAmEnvironmentID, current);
+                    }
+
+                    _applied[slot] = current;
+                }
+            }
+
+            // A send is kept until its silence has been applied to the entity.
+            if (current == 0.0f && _target[slot] == 0.0f && _applied[slot] == 0.0f)
+            {
+                RemoveSlot(static_cast<AZ::u32>(slot));
+            }
+        }
+    }
+
+    void AmplitudeSendRamps::Clear()
+    {
+        _current.clear();
+        _target.clear();
+        _applied.clear();
+        _keys.clear();
+        _slots.clear();
+        _audibleEntities.clear();
+    }
+
+    void AmplitudeSendRamps::Step(const float maxStep)
+    {
+        using AZ::Simd::Vec4;
+
+        const size_t count = _current.size();
+        const Vec4::FloatType maxDelta = Vec4::Splat(maxStep);
+        const Vec4::FloatType minDelta = Vec4::Splat(-maxStep);
+
+        size_t i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            const Vec4::FloatType current = Vec4::LoadUnaligned(&_current[i]);
+            const Vec4::FloatType target = Vec4::LoadUnaligned(&_target[i]);
+            const Vec4::FloatType delta = Vec4::Min(Vec4::Max(Vec4::Sub(target, current), minDelta), maxDelta);
+
+            Vec4::StoreUnaligned(&_current[i], Vec4::Add(current, delta));
+        }
+
+        for (; i < count; ++i)
+        {
+            _current[i] += AZStd::clamp(_target[i] - _current[i], -maxStep, maxStep);
+        }
+    }
+
+    void AmplitudeSendRamps::RemoveSlot(const AZ::u32 slot)
+    {
+        _slots.erase(_keys[slot]);
+
+        // Order doesn't matter, swap with the last slot to avoid shifting the arrays.
+        if (const size_t last = _keys.size() - 1; slot != last)
+        {
+            _current[slot] = _current[last];
+            _target[slot] = _target[last];
+            _applied[slot] = _applied[last];
+            _keys[slot] = _keys[last];
+            _slots[_keys[slot]] = slot;
+        }
+
+        _current.pop_back();
+        _target.pop_back();
+        _applied.pop_back();
+        _keys.pop_back();
+    }
+} // namespace Audio
@@ -0,0 +1,101 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+#include <Engine/AmplitudeVoiceLimiter.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Ramps the effect environment amounts of the audio objects, and applies them as per-object sends.
+    //!
+    //! Each (object, environment) amount is ramped towards its target once per audio update, four ramps at a time.
+    //! Effect environments are per-object sends in Amplitude: the ramped amount of each object is applied as the
+    //! factor of the environment on its entity.
+    //!
+    //! Only objects playing a real voice get their sends applied. The others are caught up when they become audible.
+    class AmplitudeSendRamps
+    {
+    public:
+        static constexpr AmTime DefaultRampTime = 0.1;
+
+        AmplitudeSendRamps();
+
+        //! Sets the time taken by a ramp to go from silence to full gain.
+        void SetRampTime(AmTime rampTime);
+
+        //! Sets the target factor of the environment for the given object.
+        void SetEnvironmentAmount(AmEntityID entityId, AmEnvironmentID environmentId, float amount);
+
+        //! Drops the ramps of the given object.
+        void ForgetEntity(AmEntityID entityId);
+
+        //! Drops the ramps of the given objects, sorted in ascending order, in a single pass.
+        void ForgetEntities(const TAmUniqueIDVector& sortedEntityIds);
+
+        //! Advances the ramps, and applies the resulting environment factors.
+        void Update(Engine* engine, const AmplitudeVoiceLimiter& voiceLimiter, AmTime deltaTime);
+
+        void Clear();
+
+        [[nodiscard]] size_t GetRampCount() const
+        {
+            return _current.size();
+        }
+
+    private:
+        struct SSendKey
+        {
+            AmEntityID nAmEntityID;
+            AmEnvironmentID nAmEnvironmentID;
+
+            bool operator==(const SSendKey& other) const
+            {
+                return nAmEntityID == other.nAmEntityID && nAmEnvironmentID == other.nAmEnvironmentID;
+            }
+        };
+
+        struct SSendKeyHash
+        {
+            size_t operator()(const SSendKey& key) const;
+        };
+
+        using TSlotMap = AZStd::unordered_map<SSendKey, AZ::u32, SSendKeyHash, AZStd::equal_to<SSendKey>, AudioImplStdAllocator>;
+
+        void Step(float maxStep);
+        void RemoveSlot(AZ::u32 slot);
+
+        AmTime _rampTime;
+
+        // Ramps are stored as structure of arrays, to be stepped with SIMD.
+        AZStd::vector<float, AudioImplStdAllocator> _current;
+        AZStd::vector<float, AudioImplStdAllocator> _target;
+        AZStd::vector<float, AudioImplStdAllocator> _applied;
+        AZStd::vector<SSendKey, AudioImplStdAllocator> _keys;
+        TSlotMap _slots;
+
+        AZStd::vector<AmEntityID, AudioImplStdAllocator> _audibleEntities;
+    };
+} // namespace Audio
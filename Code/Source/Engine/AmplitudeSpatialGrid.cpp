@@ -0,0 +1,313 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <Engine/AmplitudeSpatialGrid.h>
+
+namespace Audio
+{
+    // Cell coordinates are packed on 21 bits per axis in the cell keys.
+    static constexpr AZ::s32 kCellCoordinateBits = 21;
+    static constexpr AZ::s32 kCellCoordinateBias = 1 << (kCellCoordinateBits - 1);
+    static constexpr AZ::u64 kCellCoordinateMask = (AZ::u64(1) << kCellCoordinateBits) - 1;
+
+    static AZ::u64 PackCellKey(const AZ::s32 x, const AZ::s32 y, const AZ::s32 z)
+    {
+        return (AZ::u64(x + kCellCoordinateBias) << (kCellCoordinateBits * 2)) | (AZ::u64(y + kCellCoordinateBias) << kCellCoordinateBits) |
+            AZ::u64(z + kCellCoordinateBias);
+    }
+
+    static AZ::s32 UnpackCellCoordinate(const AZ::u64 key, const AZ::s32 axis)
+    {
+        return static_cast<AZ::s32>((key >> (kCellCoordinateBits * (2 - axis))) & kCellCoordinateMask) - kCellCoordinateBias;
+    }
+
+    static bool IsInsideBox(const hmm_vec3& location, const hmm_vec3& min, const hmm_vec3& max)
+    {
+        return location.X >= min.X && location.X <= max.X && location.Y >= min.Y && location.Y <= max.Y && location.Z >= min.Z &&
+            location.Z <= max.Z;
+    }
+
+    AmplitudeSpatialGrid::AmplitudeSpatialGrid()
+        : _cellSize(DefaultCellSize)
+    {
+    }
+
+    void AmplitudeSpatialGrid::SetCellSize(const float cellSize)
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        _cellSize = AZStd::max(cellSize, 0.1f);
+
+        if (_entities.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<SEntry, AudioImplStdAllocator> entries;
+        entries.reserve(_entities.size());
+
+        for (const auto& cell : _cells)
+        {
+            entries.insert(entries.end(), cell.second.begin(), cell.second.end());
+        }
+
+        _cells.clear();
+        _entities.clear();
+
+        for (const auto& entry : entries)
+        {
+            Insert(entry.nAmEntityID, entry.vLocation);
+        }
+    }
+
+    void AmplitudeSpatialGrid::SetLocation(const AmEntityID entityId, const hmm_vec3& location)
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        if (const auto it = _entities.find(entityId); it != _entities.end())
+        {
+            // Most moves stay in the same cell.
+            if (const AZ::u64 cellKey = ToCellKey(location); cellKey == it->second.nCellKey)
+            {
+                _cells[cellKey][it->second.nSlot].vLocation = location;
+                return;
+            }
+
+            Erase(it->second);
+            _entities.erase(it);
+        }
+
+        Insert(entityId, location);
+    }
+
+    void AmplitudeSpatialGrid::RemoveEntity(const AmEntityID entityId)
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        if (const auto it = _entities.find(entityId); it != _entities.end())
+        {
+            Erase(it->second);
+            _entities.erase(it);
+        }
+    }
+
+    void AmplitudeSpatialGrid::RemoveEntities(const TEntityVector& entityIds)
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        for (const AmEntityID entityId : entityIds)
+        {
+            if (const auto it = _entities.find(entityId); it != _entities.end())
+            {
+                Erase(it->second);
+                _entities.erase(it);
+            }
+        }
+    }
+
+    void AmplitudeSpatialGrid::SetZone(const AZ::u64 zoneId, const hmm_vec3& min, const hmm_vec3& max)
+    {
+        AZStd::scoped_lock lock(_mutex);
+        _zones[zoneId] = SZone{ min, max };
+    }
+
+    void AmplitudeSpatialGrid::RemoveZone(const AZ::u64 zoneId)
+    {
+        AZStd::scoped_lock lock(_mutex);
+        _zones.erase(zoneId);
+    }
+
+    void AmplitudeSpatialGrid::Query(const SQuery& query, TEntityVector& results) const
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        AZStd::scoped_lock lock(_mutex);
+        QueryLocked(query, results);
+    }
+
+    void AmplitudeSpatialGrid::Query(const AZStd::vector<SQuery>& queries, AZStd::vector<TEntityVector>& results) const
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        results.resize(queries.size());
+
+        AZStd::scoped_lock lock(_mutex);
+
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            QueryLocked(queries[i], results[i]);
+        }
+    }
+
+    void AmplitudeSpatialGrid::Clear()
+    {
+        AZStd::scoped_lock lock(_mutex);
+
+        _cells.clear();
+        _entities.clear();
+        _zones.clear();
+    }
+
+    size_t AmplitudeSpatialGrid::GetEntityCount() const
+    {
+        AZStd::scoped_lock lock(_mutex);
+        return _entities.size();
+    }
+
+    AZ::s32 AmplitudeSpatialGrid::ToCellCoordinate(const float value) const
+    {
+        const float coordinate = AZStd::floor(value / _cellSize);
+        return static_cast<AZ::s32>(AZStd::clamp(coordinate, float(-kCellCoordinateBias), float(kCellCoordinateBias - 1)));
+    }
+
+    AZ::u64 AmplitudeSpatialGrid::ToCellKey(const hmm_vec3& location) const
+    {
+        return PackCellKey(ToCellCoordinate(location.X), ToCellCoordinate(location.Y), ToCellCoordinate(location.Z));
+    }
+
+    void AmplitudeSpatialGrid::Insert(const AmEntityID entityId, const hmm_vec3& location)
+    {
+        const AZ::u64 cellKey = ToCellKey(location);
+        TCell& cell = _cells[cellKey];
+
+        _entities[entityId] = SEntityCell{ cellKey, static_cast<AZ::u32>(cell.size()) };
+        cell.push_back(SEntry{ entityId, location });
+    }
+
+    void AmplitudeSpatialGrid::Erase(const SEntityCell& entityCell)
+    {
+        const auto cellIt = _cells.find(entityCell.nCellKey);
+        if (cellIt == _cells.end())
+        {
+            return;
+        }
+
+        TCell& cell = cellIt->second;
+
+        // Swap with the last entry of the cell, and fix the slot of the moved entity.
+        if (entityCell.nSlot + 1 < cell.size())
+        {
+            cell[entityCell.nSlot] = cell.back();
+            _entities[cell[entityCell.nSlot].nAmEntityID].nSlot = entityCell.nSlot;
+        }
+
+        cell.pop_back();
+
+        if (cell.empty())
+        {
+            _cells.erase(cellIt);
+        }
+    }
+
+    void AmplitudeSpatialGrid::QueryLocked(const SQuery& query, TEntityVector& results) const
+    {
+        switch (query.eType)
+        {
+        case eSQT_RADIUS:
+            {
+                const hmm_vec3 extent = AM_Vec3(query.fRadius, query.fRadius, query.fRadius);
+                QueryBox(HMM_SubtractVec3(query.vMin, extent), HMM_AddVec3(query.vMin, extent), query, results);
+                break;
+            }
+        case eSQT_BOX:
+            {
+                QueryBox(query.vMin, query.vMax, query, results);
+                break;
+            }
+        case eSQT_ZONE:
+            {
+                if (const auto it = _zones.find(query.nZoneID); it != _zones.end())
+                {
+                    QueryBox(it->second.vMin, it->second.vMax, query, results);
+                }
+
+                break;
+            }
+        }
+    }
+
+    void AmplitudeSpatialGrid::QueryBox(const hmm_vec3& min, const hmm_vec3& max, const SQuery& query, TEntityVector& results) const
+    {
+        const float radiusSq = query.fRadius * query.fRadius;
+
+        const auto visitCell = [&](const TCell& cell)
+        {
+            for (const auto& entry : cell)
+            {
+                const bool isInside = query.eType == eSQT_RADIUS
+                    ? HMM_LengthSquaredVec3(HMM_SubtractVec3(entry.vLocation, query.vMin)) <= radiusSq
+                    : IsInsideBox(entry.vLocation, min, max);
+
+                if (isInside)
+                {
+                    results.push_back(entry.nAmEntityID);
+                }
+            }
+        };
+
+        const AZ::s32 minCell[3] = { ToCellCoordinate(min.X), ToCellCoordinate(min.Y), ToCellCoordinate(min.Z) };
+        const AZ::s32 maxCell[3] = { ToCellCoordinate(max.X), ToCellCoordinate(max.Y), ToCellCoordinate(max.Z) };
+
+        AZ::u64 cellCount = 1;
+        for (AZ::s32 axis = 0; axis < 3; ++axis)
+        {
+            if (maxCell[axis] < minCell[axis])
+            {
+                return;
+            }
+
+            cellCount *= AZ::u64(maxCell[axis] - minCell[axis] + 1);
+        }
+
+        // Large queries on a sparse grid are cheaper when walking the occupied cells.
+        if (cellCount > _cells.size())
+        {
+            for (const auto& cell : _cells)
+            {
+                bool isOverlapping = true;
+                for (AZ::s32 axis = 0; axis < 3 && isOverlapping; ++axis)
+                {
+                    const AZ::s32 coordinate = UnpackCellCoordinate(cell.first, axis);
+                    isOverlapping = coordinate >= minCell[axis] && coordinate <= maxCell[axis];
+                }
+
+                if (isOverlapping)
+                {
+                    visitCell(cell.second);
+                }
+            }
+
+            return;
+        }
+
+        for (AZ::s32 x = minCell[0]; x <= maxCell[0]; ++x)
+        {
+            for (AZ::s32 y = minCell[1]; y <= maxCell[1]; ++y)
+            {
+                for (AZ::s32 z = minCell[2]; z <= maxCell[2]; ++z)
+                {
+                    if (const auto it = _cells.find(PackCellKey(x, y, z)); it != _cells.end())
+                    {
+                        visitCell(it->second);
+                    }
+                }
+            }
+        }
+    }
+} // namespace Audio
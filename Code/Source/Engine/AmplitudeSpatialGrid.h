@@ -0,0 +1,124 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Uniform grid of the positioned audio entities, kept up to date from the positions received through the ATL.
+    //!
+    //! Only the occupied cells are stored, in a hash map. A query visits the cells overlapping its bounds, or the
+    //! occupied cells when there are fewer of them, so its cost depends on the number of entities around the
+    //! queried area and not on the total number of entities. Queries can be made from any thread.
+    class AmplitudeSpatialGrid
+    {
+    public:
+        static constexpr float DefaultCellSize = 10.0f;
+
+        using TEntityVector = AZStd::vector<AmEntityID, AudioImplStdAllocator>;
+
+        enum EQueryType : AZ::u8
+        {
+            eSQT_RADIUS,
+            eSQT_BOX,
+            eSQT_ZONE,
+        };
+
+        struct SQuery
+        {
+            EQueryType eType;
+            //! Center of a radius query, or minimum corner of a box query.
+            hmm_vec3 vMin;
+            //! Maximum corner of a box query.
+            hmm_vec3 vMax;
+            float fRadius;
+            AZ::u64 nZoneID;
+        };
+
+        AmplitudeSpatialGrid();
+
+        //! Changes the size of the cells, and re-indexes all the entities.
+        void SetCellSize(float cellSize);
+
+        //! Adds the entity to the grid, or moves it if it is already there.
+        void SetLocation(AmEntityID entityId, const hmm_vec3& location);
+
+        void RemoveEntity(AmEntityID entityId);
+
+        //! Removes a list of entities, taking the lock once.
+        void RemoveEntities(const TEntityVector& entityIds);
+
+        //! Registers a named box, which can be queried with eSQT_ZONE queries.
+        void SetZone(AZ::u64 zoneId, const hmm_vec3& min, const hmm_vec3& max);
+        void RemoveZone(AZ::u64 zoneId);
+
+        //! Appends the entities matching the query to the results.
+        void Query(const SQuery& query, TEntityVector& results) const;
+
+        //! Runs all the queries under a single lock. Results are stored in the same order as the queries.
+        void Query(const AZStd::vector<SQuery>& queries, AZStd::vector<TEntityVector>& results) const;
+
+        void Clear();
+
+        [[nodiscard]] size_t GetEntityCount() const;
+
+    private:
+        struct SEntry
+        {
+            AmEntityID nAmEntityID;
+            hmm_vec3 vLocation;
+        };
+
+        struct SEntityCell
+        {
+            AZ::u64 nCellKey;
+            AZ::u32 nSlot;
+        };
+
+        struct SZone
+        {
+            hmm_vec3 vMin;
+            hmm_vec3 vMax;
+        };
+
+        using TCell = AZStd::vector<SEntry, AudioImplStdAllocator>;
+
+        [[nodiscard]] AZ::s32 ToCellCoordinate(float value) const;
+        [[nodiscard]] AZ::u64 ToCellKey(const hmm_vec3& location) const;
+
+        void Insert(AmEntityID entityId, const hmm_vec3& location);
+        void Erase(const SEntityCell& entityCell);
+
+        void QueryLocked(const SQuery& query, TEntityVector& results) const;
+        void QueryBox(const hmm_vec3& min, const hmm_vec3& max, const SQuery& query, TEntityVector& results) const;
+
+        mutable AZStd::mutex _mutex;
+        float _cellSize;
+        AZStd::unordered_map<AZ::u64, TCell, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, AudioImplStdAllocator> _cells;
+        AZStd::unordered_map<AmEntityID, SEntityCell, AZStd::hash<AmEntityID>, AZStd::equal_to<AmEntityID>, AudioImplStdAllocator>
+            _entities;
+        AZStd::unordered_map<AZ::u64, SZone, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, AudioImplStdAllocator> _zones;
+    };
+} // namespace Audio
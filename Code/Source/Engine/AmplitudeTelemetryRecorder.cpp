@@ -0,0 +1,358 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/time.h>
+
+#include <Engine/AmplitudeTelemetryRecorder.h>
+
+namespace Audio
+{
+    static constexpr const char* kRequestTypeColumnNames[] = {
+        "register_object",
+        "unregister_object",
+        "activate_trigger",
+        "stop_event",
+        "set_position",
+        "set_environment",
+        "set_rtpc",
+        "reset_rtpc",
+        "set_switch_state",
+        "set_obstruction_occlusion",
+        "set_listener_position",
+        "register_bank",
+        "unregister_bank",
+    };
+
+    static_assert(
+        AZ_ARRAY_SIZE(kRequestTypeColumnNames) == static_cast<size_t>(AudioRequestType::Count),
+        "A column name is required for each request type.");
+
+    // The writer thread wakes up at this interval to write the pending samples.
+    static constexpr AZStd::chrono::milliseconds kFlushInterval(250);
+
+    // Samples are dropped past this count, when the writer can't keep up with the audio thread.
+    static constexpr size_t kMaxPendingSamples = 4096;
+
+    static void AppendFormat(AZStd::string& buffer, const char* format, ...)
+    {
+        char line[256];
+
+        va_list args;
+        va_start(args, format);
+        const int length = azvsnprintf(line, sizeof(line), format, args);
+        va_end(args);
+
+        if (length > 0)
+        {
+            buffer.append(line, AZStd::min(static_cast<size_t>(length), sizeof(line) - 1));
+        }
+    }
+
+    AmplitudeTelemetryRecorder::AmplitudeTelemetryRecorder()
+        : _format(eTF_CSV)
+        , _path(DefaultPath)
+        , _maxFileSize(DefaultMaxFileSize)
+        , _maxFileCount(DefaultMaxFileCount)
+        , _frame(0)
+        , _droppedSampleCount(0)
+        , _isRunning(false)
+        , _sessionId(0)
+        , _fileIndex(0)
+        , _fileSize(0)
+    {
+    }
+
+    AmplitudeTelemetryRecorder::~AmplitudeTelemetryRecorder()
+    {
+        Stop();
+    }
+
+    void AmplitudeTelemetryRecorder::SetFormat(const EFormat format)
+    {
+        _format = format;
+    }
+
+    void AmplitudeTelemetryRecorder::SetPath(const AZStd::string& path)
+    {
+        _path = path;
+    }
+
+    void AmplitudeTelemetryRecorder::SetMaxFileSize(const AZ::u64 maxFileSize)
+    {
+        _maxFileSize = AZStd::max<AZ::u64>(maxFileSize, 64 * 1024);
+    }
+
+    void AmplitudeTelemetryRecorder::SetMaxFileCount(const AZ::u32 maxFileCount)
+    {
+        _maxFileCount = AZStd::max(maxFileCount, 1u);
+    }
+
+    bool AmplitudeTelemetryRecorder::Start(const AZStd::vector<AZStd::string>& memoryPoolNames)
+    {
+        if (_isRunning)
+        {
+            return true;
+        }
+
+        char resolvedPath[AZ_MAX_PATH_LEN] = { 0 };
+        if (AZ::IO::FileIOBase::GetInstance() == nullptr ||
+            !AZ::IO::FileIOBase::GetInstance()->ResolvePath(_path.c_str(), resolvedPath, AZ_MAX_PATH_LEN))
+        {
+            AZLOG_WARN("[Amplitude] Unable to resolve the telemetry path '%s'.", _path.c_str());
+            return false;
+        }
+
+        _resolvedPath = resolvedPath;
+        _memoryPoolNames.assign(
+            memoryPoolNames.begin(), memoryPoolNames.begin() + AZStd::min(memoryPoolNames.size(), MaxMemoryPools));
+
+        _sessionId = AZStd::GetTimeUTCMilliSecond();
+        _fileIndex = 0;
+
+        if (!OpenFile())
+        {
+            return false;
+        }
+
+        _frame = 0;
+        _startTime = AZStd::chrono::steady_clock::now();
+        _droppedSampleCount = 0;
+        _pending.reserve(kMaxPendingSamples);
+        _isRunning = true;
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Amplitude Telemetry";
+
+        _writerThread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                WriterThread();
+            });
+
+        AZLOG_INFO("[Amplitude] Recording telemetry to '%s'.", GetFilePath(0).c_str());
+        return true;
+    }
+
+    void AmplitudeTelemetryRecorder::Stop()
+    {
+        if (!_isRunning)
+        {
+            return;
+        }
+
+        {
+            AZStd::scoped_lock lock(_pendingMutex);
+            _isRunning = false;
+        }
+
+        _wakeUp.notify_one();
+        _writerThread.join();
+
+        _file.Close();
+
+        if (_droppedSampleCount > 0)
+        {
+            AZLOG_WARN("[Amplitude] %llu telemetry samples have been dropped, the writer could not keep up.", _droppedSampleCount);
+        }
+    }
+
+    void AmplitudeTelemetryRecorder::Record(SSample& sample)
+    {
+        if (!_isRunning)
+        {
+            return;
+        }
+
+        sample.nFrame = _frame++;
+        sample.fTimeMs = AZStd::chrono::duration<double, AZStd::milli>(AZStd::chrono::steady_clock::now() - _startTime).count();
+
+        AZStd::scoped_lock lock(_pendingMutex);
+
+        if (_pending.size() >= kMaxPendingSamples)
+        {
+            ++_droppedSampleCount;
+            return;
+        }
+
+        _pending.push_back(sample);
+    }
+
+    void AmplitudeTelemetryRecorder::WriterThread()
+    {
+        TSampleVector samples;
+        samples.reserve(kMaxPendingSamples);
+
+        bool isRunning = true;
+        while (isRunning)
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(_pendingMutex);
+                _wakeUp.wait_for(
+                    lock,
+                    kFlushInterval,
+                    [this]()
+                    {
+                        return !_isRunning;
+                    });
+
+                // Swapping keeps both allocations alive, so recording doesn't allocate once both have grown.
+                samples.swap(_pending);
+                isRunning = _isRunning;
+            }
+
+            WriteSamples(samples);
+            samples.clear();
+        }
+    }
+
+    void AmplitudeTelemetryRecorder::WriteSamples(const TSampleVector& samples)
+    {
+        if (samples.empty() || !_file.IsOpen())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Audio);
+
+        AZStd::string buffer;
+        buffer.reserve(samples.size() * 256);
+
+        for (const SSample& sample : samples)
+        {
+            FormatSample(sample, buffer);
+        }
+
+        _fileSize += _file.Write(buffer.data(), buffer.size());
+
+        if (_fileSize < _maxFileSize)
+        {
+            return;
+        }
+
+        _file.Close();
+        ++_fileIndex;
+
+        if (_fileIndex >= _maxFileCount)
+        {
+            AZ::IO::SystemFile::Delete(GetFilePath(_fileIndex - _maxFileCount).c_str());
+        }
+
+        OpenFile();
+    }
+
+    void AmplitudeTelemetryRecorder::FormatHeader(AZStd::string& buffer) const
+    {
+        buffer += "frame,time_ms,engine_update_ms,average_engine_update_ms,max_engine_update_ms,"
+                  "real_voices,virtual_voices,accepted_triggers,suppressed_triggers,active_entities,registered_bank_bytes";
+
+        for (const char* name : kRequestTypeColumnNames)
+        {
+            AppendFormat(buffer, ",%s", name);
+        }
+
+        for (const AZStd::string& name : _memoryPoolNames)
+        {
+            AppendFormat(buffer, ",memory_%s", name.c_str());
+        }
+
+        buffer += '\n';
+    }
+
+    void AmplitudeTelemetryRecorder::FormatSample(const SSample& sample, AZStd::string& buffer) const
+    {
+        const AudioFrameStats& stats = sample.sFrameStats;
+
+        if (_format == eTF_CSV)
+        {
+            AppendFormat(
+                buffer, "%llu,%.3f,%.3f,%.3f,%.3f,%u,%u,%u,%u,%u,%llu", sample.nFrame, sample.fTimeMs, stats.m_engineUpdateTimeMs,
+                stats.m_averageEngineUpdateTimeMs, stats.m_maxEngineUpdateTimeMs, stats.m_realVoiceCount, stats.m_virtualVoiceCount,
+                stats.m_acceptedTriggerCount, stats.m_suppressedTriggerCount, stats.m_activeEntityCount, stats.m_registeredBankBytes);
+
+            for (const AZ::u32 count : stats.m_requestCounts)
+            {
+                AppendFormat(buffer, ",%u", count);
+            }
+
+            for (size_t i = 0; i < _memoryPoolNames.size(); ++i)
+            {
+                AppendFormat(buffer, ",%llu", sample.cMemoryUsed[i]);
+            }
+
+            buffer += '\n';
+            return;
+        }
+
+        AppendFormat(
+            buffer,
+            R"({"frame":%llu,"time_ms":%.3f,"engine_update_ms":%.3f,"average_engine_update_ms":%.3f,"max_engine_update_ms":%.3f,)"
+            R"("real_voices":%u,"virtual_voices":%u,"accepted_triggers":%u,"suppressed_triggers":%u,"active_entities":%u,)"
+            R"("registered_bank_bytes":%llu,"requests":{)",
+            sample.nFrame, sample.fTimeMs, stats.m_engineUpdateTimeMs, stats.m_averageEngineUpdateTimeMs, stats.m_maxEngineUpdateTimeMs,
+            stats.m_realVoiceCount, stats.m_virtualVoiceCount, stats.m_acceptedTriggerCount, stats.m_suppressedTriggerCount,
+            stats.m_activeEntityCount, stats.m_registeredBankBytes);
+
+        for (size_t i = 0; i < stats.m_requestCounts.size(); ++i)
+        {
+            AppendFormat(buffer, R"(%s"%s":%u)", i > 0 ? "," : "", kRequestTypeColumnNames[i], stats.m_requestCounts[i]);
+        }
+
+        buffer += R"(},"memory":{)";
+
+        for (size_t i = 0; i < _memoryPoolNames.size(); ++i)
+        {
+            AppendFormat(buffer, R"(%s"%s":%llu)", i > 0 ? "," : "", _memoryPoolNames[i].c_str(), sample.cMemoryUsed[i]);
+        }
+
+        buffer += "}}\n";
+    }
+
+    bool AmplitudeTelemetryRecorder::OpenFile()
+    {
+        const AZStd::string filePath = GetFilePath(_fileIndex);
+
+        constexpr int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+
+        if (!_file.Open(filePath.c_str(), openMode))
+        {
+            AZLOG_WARN("[Amplitude] Unable to open the telemetry file '%s'.", filePath.c_str());
+            return false;
+        }
+
+        _fileSize = 0;
+
+        // JSON lines are self-describing, only CSV files need a header.
+        if (_format == eTF_CSV)
+        {
+            AZStd::string header;
+            FormatHeader(header);
+            _fileSize += _file.Write(header.data(), header.size());
+        }
+
+        return true;
+    }
+
+    AZStd::string AmplitudeTelemetryRecorder::GetFilePath(const AZ::u32 fileIndex) const
+    {
+        return AZStd::string::format(
+            "%s/amplitude_telemetry_%llu_%03u.%s", _resolvedPath.c_str(), _sessionId, fileIndex, _format == eTF_CSV ? "csv" : "jsonl");
+    }
+} // namespace Audio
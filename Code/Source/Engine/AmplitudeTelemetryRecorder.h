@@ -0,0 +1,121 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+#include <SparkyStudios/Audio/Amplitude/AmplitudeAudioBus.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Records one row of performance counters per audio update, and streams them to disk.
+    //!
+    //! The audio thread only copies each sample into a pending list. A writer thread formats the pending
+    //! samples a few times per second and appends them to the current file, as CSV or as JSON lines. Once a
+    //! file grows past the size limit, a new one is started and the oldest files of the session are deleted.
+    class AmplitudeTelemetryRecorder
+    {
+    public:
+        static constexpr size_t MaxMemoryPools = static_cast<size_t>(MemoryPoolKind::COUNT);
+        static constexpr AZ::u64 DefaultMaxFileSize = 8 * 1024 * 1024;
+        static constexpr AZ::u32 DefaultMaxFileCount = 4;
+        static constexpr const char* DefaultPath = "@user@/Amplitude/Telemetry";
+
+        enum EFormat : AZ::u8
+        {
+            eTF_CSV,
+            eTF_JSON,
+        };
+
+        struct SSample
+        {
+            AZ::u64 nFrame;
+            double fTimeMs;
+            AudioFrameStats sFrameStats;
+            //! Memory used by each pool, in the order of the pool names given to Start().
+            AZStd::array<AZ::u64, MaxMemoryPools> cMemoryUsed;
+        };
+
+        AmplitudeTelemetryRecorder();
+        ~AmplitudeTelemetryRecorder();
+
+        void SetFormat(EFormat format);
+        void SetPath(const AZStd::string& path);
+        void SetMaxFileSize(AZ::u64 maxFileSize);
+        void SetMaxFileCount(AZ::u32 maxFileCount);
+
+        //! Opens the first file of a new session and starts the writer thread.
+        //! @param memoryPoolNames Names of the memory pools recorded in each sample, at most MaxMemoryPools.
+        bool Start(const AZStd::vector<AZStd::string>& memoryPoolNames);
+
+        //! Writes the pending samples, and stops the writer thread.
+        void Stop();
+
+        [[nodiscard]] bool IsRunning() const
+        {
+            return _isRunning;
+        }
+
+        //! Queues a sample for writing. The frame number and time stamp are set by the recorder.
+        void Record(SSample& sample);
+
+    private:
+        using TSampleVector = AZStd::vector<SSample>;
+
+        void WriterThread();
+        void WriteSamples(const TSampleVector& samples);
+        void FormatHeader(AZStd::string& buffer) const;
+        void FormatSample(const SSample& sample, AZStd::string& buffer) const;
+
+        bool OpenFile();
+        [[nodiscard]] AZStd::string GetFilePath(AZ::u32 fileIndex) const;
+
+        EFormat _format;
+        AZStd::string _path;
+        AZ::u64 _maxFileSize;
+        AZ::u32 _maxFileCount;
+
+        AZStd::vector<AZStd::string> _memoryPoolNames;
+        AZStd::chrono::steady_clock::time_point _startTime;
+        AZ::u64 _frame;
+
+        AZStd::mutex _pendingMutex;
+        AZStd::condition_variable _wakeUp;
+        TSampleVector _pending;
+        AZ::u64 _droppedSampleCount;
+
+        AZStd::atomic_bool _isRunning;
+        AZStd::thread _writerThread;
+
+        // Only used by the writer thread while it runs.
+        AZ::IO::SystemFile _file;
+        AZStd::string _resolvedPath;
+        AZ::u64 _sessionId;
+        AZ::u32 _fileIndex;
+        AZ::u64 _fileSize;
+    };
+} // namespace Audio
@@ -0,0 +1,110 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+
+#include <Engine/AmplitudeTriggerThrottle.h>
+
+namespace Audio
+{
+    size_t AmplitudeTriggerThrottle::SWindowKeyHash::operator()(const TWindowKey& key) const
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(hash, key.first, key.second);
+        return hash;
+    }
+
+    AmplitudeTriggerThrottle::AmplitudeTriggerThrottle()
+        : _time(0.0)
+    {
+    }
+
+    void AmplitudeTriggerThrottle::Update(const AmTime deltaTime)
+    {
+        _time += deltaTime;
+
+        for (auto it = _windows.begin(); it != _windows.end();)
+        {
+            if (it->second.fEndTime <= _time)
+            {
+                it = _windows.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    bool AmplitudeTriggerThrottle::TryActivate(
+        const AmEntityID entityId, const AmEventID eventId, const AmTime window, const AZ::u32 maxInstances)
+    {
+        if (window <= 0.0)
+        {
+            return true;
+        }
+
+        auto [it, inserted] = _windows.try_emplace(TWindowKey(entityId, eventId), SWindow{ _time + window, 0 });
+
+        // The window may have expired since the last update.
+        if (!inserted && it->second.fEndTime <= _time)
+        {
+            it->second = SWindow{ _time + window, 0 };
+        }
+
+        if (it->second.nInstanceCount >= maxInstances)
+        {
+            return false;
+        }
+
+        ++it->second.nInstanceCount;
+        return true;
+    }
+
+    void AmplitudeTriggerThrottle::ForgetEntity(const AmEntityID entityId)
+    {
+        for (auto it = _windows.begin(); it != _windows.end();)
+        {
+            if (it->first.first == entityId)
+            {
+                it = _windows.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void AmplitudeTriggerThrottle::ForgetEntities(const TAmUniqueIDVector& sortedEntityIds)
+    {
+        for (auto it = _windows.begin(); it != _windows.end();)
+        {
+            if (AZStd::binary_search(sortedEntityIds.begin(), sortedEntityIds.end(), it->first.first))
+            {
+                it = _windows.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void AmplitudeTriggerThrottle::Clear()
+    {
+        _windows.clear();
+    }
+} // namespace Audio
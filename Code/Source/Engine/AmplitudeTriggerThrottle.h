@@ -0,0 +1,79 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/utils.h>
+
+#include <Engine/ATLEntities_amplitude.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Coalesces the activations of the same trigger on the same audio object.
+    //!
+    //! Triggers with a coalescing window accept at most a given number of activations per audio object within
+    //! that window, starting from the first accepted activation. Activations past that limit are suppressed
+    //! before reaching Amplitude.
+    class AmplitudeTriggerThrottle
+    {
+    public:
+        AmplitudeTriggerThrottle();
+
+        //! Advances the throttle clock, and forgets the windows which have expired.
+        void Update(AmTime deltaTime);
+
+        //! Checks whether the given event can be triggered on the given audio object, and records the activation if so.
+        //! @param entityId The Amplitude ID of the ATL audio object, not the entity it plays on: the non-positional objects
+        //! all play on the same global entity.
+        //! @param window The coalescing window of the trigger, in seconds. Activations are never suppressed when zero.
+        //! @param maxInstances The maximum number of activations accepted within the window.
+        bool TryActivate(AmEntityID entityId, AmEventID eventId, AmTime window, AZ::u32 maxInstances);
+
+        //! Forgets all the windows opened for the given entity.
+        void ForgetEntity(AmEntityID entityId);
+
+        //! Forgets all the windows opened for the given entities, in a single pass.
+        //! @param sortedEntityIds The entities to forget, sorted in ascending order.
+        void ForgetEntities(const TAmUniqueIDVector& sortedEntityIds);
+
+        void Clear();
+
+    private:
+        using TWindowKey = AZStd::pair<AmEntityID, AmEventID>;
+
+        struct SWindowKeyHash
+        {
+            size_t operator()(const TWindowKey& key) const;
+        };
+
+        struct SWindow
+        {
+            AmTime fEndTime;
+            AZ::u32 nInstanceCount;
+        };
+
+        using TWindowMap = AZStd::unordered_map<TWindowKey, SWindow, SWindowKeyHash, AZStd::equal_to<TWindowKey>, AudioImplStdAllocator>;
+
+        TWindowMap _windows;
+        AmTime _time;
+    };
+} // namespace Audio
@@ -0,0 +1,294 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+
+#include <Engine/AmplitudeUpdateLod.h>
+
+namespace Audio
+{
+    // Number of objects whose band is re-evaluated each frame, when the listener moves.
+    static constexpr size_t kBandEvaluationsPerFrame = 64;
+
+    AmplitudeUpdateLod::AmplitudeUpdateLod(const AmplitudeListenerSet* const listeners)
+        : _bandCount(0)
+        , _nextEvaluatedObject(0)
+        , _listeners(listeners)
+        , _frame(0)
+    {
+        for (auto& count : _bandObjectCounts)
+        {
+            count.store(0);
+        }
+
+        SetBands({ { 25.0f, 1 }, { 100.0f, 4 }, { AZStd::numeric_limits<float>::max(), 16 } });
+    }
+
+    void AmplitudeUpdateLod::SetBands(const AZStd::vector<SBand>& bands)
+    {
+        _bandCount = AZStd::clamp<size_t>(bands.size(), 1, MaxBands);
+
+        for (size_t i = 0; i < _bandCount; ++i)
+        {
+            _bands[i] = i < bands.size() ? bands[i] : SBand{ 0.0f, 1 };
+            _bands[i].nInterval = AZStd::max(_bands[i].nInterval, 1u);
+        }
+
+        // The last band catches everything beyond the previous ones.
+        _bands[_bandCount - 1].fMaxDistance = AZStd::numeric_limits<float>::max();
+
+        for (auto& count : _bandObjectCounts)
+        {
+            count.store(0);
+        }
+
+        for (auto* objectData : _objects)
+        {
+            objectData->nLodBand = ComputeBand(objectData->vLocation);
+            _bandObjectCounts[objectData->nLodBand].fetch_add(1);
+        }
+    }
+
+    void AmplitudeUpdateLod::AddObject(SATLAudioObjectData_Amplitude* const objectData)
+    {
+        objectData->nLodBand = ComputeBand(objectData->vLocation);
+        _bandObjectCounts[objectData->nLodBand].fetch_add(1);
+        _objects.push_back(objectData);
+    }
+
+    void AmplitudeUpdateLod::RemoveObject(SATLAudioObjectData_Amplitude* const objectData)
+    {
+        if (const auto it = AZStd::find(_objects.begin(), _objects.end(), objectData); it != _objects.end())
+        {
+            _bandObjectCounts[objectData->nLodBand].fetch_sub(1);
+
+            *it = _objects.back();
+            _objects.pop_back();
+        }
+
+        if (objectData->bIsLodTracked)
+        {
+            _dirtyObjects.erase(AZStd::remove(_dirtyObjects.begin(), _dirtyObjects.end(), objectData), _dirtyObjects.end());
+            objectData->bIsLodTracked = false;
+        }
+    }
+
+    void AmplitudeUpdateLod::RemoveObjects(const TAmUniqueIDVector& sortedEntityIds)
+    {
+        const auto isRemoved = [&sortedEntityIds](const SATLAudioObjectData_Amplitude* const objectData)
+        {
+            return AZStd::binary_search(sortedEntityIds.begin(), sortedEntityIds.end(), objectData->nAmID);
+        };
+
+        for (size_t i = _objects.size(); i > 0; --i)
+        {
+            if (SATLAudioObjectData_Amplitude* const objectData = _objects[i - 1]; isRemoved(objectData))
+            {
+                _bandObjectCounts[objectData->nLodBand].fetch_sub(1);
+
+                _objects[i - 1] = _objects.back();
+                _objects.pop_back();
+            }
+        }
+
+        const auto dirtyEnd = AZStd::remove_if(
+            _dirtyObjects.begin(),
+            _dirtyObjects.end(),
+            [&isRemoved](SATLAudioObjectData_Amplitude* const objectData)
+            {
+                if (!isRemoved(objectData))
+                {
+                    return false;
+                }
+
+                objectData->bIsLodTracked = false;
+                return true;
+            });
+
+        _dirtyObjects.erase(dirtyEnd, _dirtyObjects.end());
+    }
+
+    bool AmplitudeUpdateLod::DeferTransform(
+        SATLAudioObjectData_Amplitude* const objectData, const hmm_vec3& location, const hmm_vec3& forward, const hmm_vec3& up)
+    {
+        SetObjectBand(objectData, ComputeBand(location));
+
+        if (IsImmediate(objectData))
+        {
+            objectData->vLocation = location;
+            objectData->bHasPendingTransform = false;
+            return true;
+        }
+
+        objectData->vPendingLocation = location;
+        objectData->vPendingForward = forward;
+        objectData->vPendingUp = up;
+        objectData->bHasPendingTransform = true;
+        TrackDirtyObject(objectData);
+
+        return false;
+    }
+
+    bool AmplitudeUpdateLod::DeferObstructionOcclusion(
+        SATLAudioObjectData_Amplitude* const objectData, const float obstruction, const float occlusion, const bool hasOcclusion)
+    {
+        if (IsImmediate(objectData))
+        {
+            objectData->bHasPendingObstruction = false;
+            objectData->bHasPendingOcclusion = false;
+            return true;
+        }
+
+        objectData->fPendingObstruction = obstruction;
+        objectData->bHasPendingObstruction = true;
+
+        if (hasOcclusion)
+        {
+            objectData->fPendingOcclusion = occlusion;
+            objectData->bHasPendingOcclusion = true;
+        }
+
+        TrackDirtyObject(objectData);
+        return false;
+    }
+
+    void AmplitudeUpdateLod::Update(Engine* const engine)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        ++_frame;
+
+        const size_t evaluations = AZStd::min(kBandEvaluationsPerFrame, _objects.size());
+        for (size_t i = 0; i < evaluations; ++i)
+        {
+            _nextEvaluatedObject = _nextEvaluatedObject < _objects.size() ? _nextEvaluatedObject : 0;
+
+            SATLAudioObjectData_Amplitude* objectData = _objects[_nextEvaluatedObject++];
+            SetObjectBand(objectData, ComputeBand(objectData->bHasPendingTransform ? objectData->vPendingLocation : objectData->vLocation));
+        }
+
+        for (auto it = _dirtyObjects.begin(); it != _dirtyObjects.end();)
+        {
+            SATLAudioObjectData_Amplitude* objectData = *it;
+            const AZ::u32 interval = _bands[objectData->nLodBand].nInterval;
+
+            if ((_frame + objectData->nAmID) % interval != 0)
+            {
+                ++it;
+                continue;
+            }
+
+            Flush(engine, objectData);
+
+            objectData->bIsLodTracked = false;
+            *it = _dirtyObjects.back();
+            _dirtyObjects.pop_back();
+        }
+    }
+
+    void AmplitudeUpdateLod::Clear()
+    {
+        for (auto* objectData : _dirtyObjects)
+        {
+            objectData->bIsLodTracked = false;
+        }
+
+        for (auto& count : _bandObjectCounts)
+        {
+            count.store(0);
+        }
+
+        _objects.clear();
+        _dirtyObjects.clear();
+        _nextEvaluatedObject = 0;
+    }
+
+    AZ::u32 AmplitudeUpdateLod::GetBandObjectCount(const size_t band) const
+    {
+        return band < MaxBands ? _bandObjectCounts[band].load(AZStd::memory_order_relaxed) : 0;
+    }
+
+    AZ::u8 AmplitudeUpdateLod::ComputeBand(const hmm_vec3& location) const
+    {
+        const float distance = HMM_LengthVec3(HMM_SubtractVec3(location, _listeners->GetNearestLocation(location)));
+
+        for (size_t i = 0; i < _bandCount; ++i)
+        {
+            if (distance <= _bands[i].fMaxDistance)
+            {
+                return static_cast<AZ::u8>(i);
+            }
+        }
+
+        return static_cast<AZ::u8>(_bandCount - 1);
+    }
+
+    bool AmplitudeUpdateLod::IsImmediate(const SATLAudioObjectData_Amplitude* const objectData) const
+    {
+        return _bands[objectData->nLodBand].nInterval <= 1;
+    }
+
+    void AmplitudeUpdateLod::SetObjectBand(SATLAudioObjectData_Amplitude* const objectData, const AZ::u8 band)
+    {
+        if (objectData->nLodBand == band)
+        {
+            return;
+        }
+
+        _bandObjectCounts[objectData->nLodBand].fetch_sub(1);
+        _bandObjectCounts[band].fetch_add(1);
+        objectData->nLodBand = band;
+    }
+
+    void AmplitudeUpdateLod::TrackDirtyObject(SATLAudioObjectData_Amplitude* const objectData)
+    {
+        if (!objectData->bIsLodTracked)
+        {
+            objectData->bIsLodTracked = true;
+            _dirtyObjects.push_back(objectData);
+        }
+    }
+
+    void AmplitudeUpdateLod::Flush(Engine* const engine, SATLAudioObjectData_Amplitude* const objectData)
+    {
+        Entity entity = engine->GetEntity(objectData->nAmID);
+
+        if (entity.Valid())
+        {
+            // Amplitude ramps gains and pans between mixer blocks, so values applied at a lower rate don't click.
+            if (objectData->bHasPendingTransform)
+            {
+                entity.SetLocation(objectData->vPendingLocation);
+                entity.SetOrientation(objectData->vPendingForward, objectData->vPendingUp);
+                objectData->vLocation = objectData->vPendingLocation;
+            }
+
+            if (objectData->bHasPendingObstruction)
+            {
+                entity.SetObstruction(objectData->fPendingObstruction);
+            }
+
+            if (objectData->bHasPendingOcclusion)
+            {
+                entity.SetOcclusion(objectData->fPendingOcclusion);
+            }
+        }
+
+        objectData->bHasPendingTransform = false;
+        objectData->bHasPendingObstruction = false;
+        objectData->bHasPendingOcclusion = false;
+    }
+} // namespace Audio
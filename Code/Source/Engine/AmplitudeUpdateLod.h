@@ -0,0 +1,102 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#include <Engine/ATLEntities_amplitude.h>
+#include <Engine/AmplitudeListenerSet.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Lowers the rate at which far audio objects update their Amplitude entity.
+    //!
+    //! Objects are sorted in distance bands around their nearest listener. Changes to objects in the first band
+    //! are applied immediately, changes to objects in the other bands are kept in the object data and flushed
+    //! every Nth update of their band. Flushes are spread over the frames using the object ID.
+    class AmplitudeUpdateLod
+    {
+    public:
+        static constexpr size_t MaxBands = 8;
+
+        struct SBand
+        {
+            float fMaxDistance;
+            AZ::u32 nInterval;
+        };
+
+        explicit AmplitudeUpdateLod(const AmplitudeListenerSet* listeners);
+
+        //! Replaces the distance bands. Bands must be sorted by distance, the last one covers all the remaining distances.
+        void SetBands(const AZStd::vector<SBand>& bands);
+
+        void AddObject(SATLAudioObjectData_Amplitude* objectData);
+        void RemoveObject(SATLAudioObjectData_Amplitude* objectData);
+
+        //! Removes the objects of the given entities, sorted in ascending order, in a single pass.
+        void RemoveObjects(const TAmUniqueIDVector& sortedEntityIds);
+
+        //! Records a new transform for the object.
+        //! @return Whether the transform must be applied immediately.
+        bool DeferTransform(
+            SATLAudioObjectData_Amplitude* objectData, const hmm_vec3& location, const hmm_vec3& forward, const hmm_vec3& up);
+
+        //! Records new obstruction and occlusion values for the object.
+        //! @return Whether the values must be applied immediately.
+        bool DeferObstructionOcclusion(SATLAudioObjectData_Amplitude* objectData, float obstruction, float occlusion, bool hasOcclusion);
+
+        //! Re-evaluates the bands of a few objects, and flushes the pending changes of the objects due this frame.
+        void Update(Engine* engine);
+
+        void Clear();
+
+        [[nodiscard]] size_t GetBandCount() const
+        {
+            return _bandCount;
+        }
+
+        //! Gets the number of registered objects in the given band. Can be called from any thread.
+        [[nodiscard]] AZ::u32 GetBandObjectCount(size_t band) const;
+
+    private:
+        [[nodiscard]] AZ::u8 ComputeBand(const hmm_vec3& location) const;
+        [[nodiscard]] bool IsImmediate(const SATLAudioObjectData_Amplitude* objectData) const;
+
+        void SetObjectBand(SATLAudioObjectData_Amplitude* objectData, AZ::u8 band);
+        void TrackDirtyObject(SATLAudioObjectData_Amplitude* objectData);
+        void Flush(Engine* engine, SATLAudioObjectData_Amplitude* objectData);
+
+        AZStd::array<SBand, MaxBands> _bands;
+        size_t _bandCount;
+        AZStd::array<AZStd::atomic<AZ::u32>, MaxBands> _bandObjectCounts;
+
+        // All the registered objects, their band is re-evaluated a few at a time as the listener moves.
+        AZStd::vector<SATLAudioObjectData_Amplitude*, AudioImplStdAllocator> _objects;
+        size_t _nextEvaluatedObject;
+
+        AZStd::vector<SATLAudioObjectData_Amplitude*, AudioImplStdAllocator> _dirtyObjects;
+        const AmplitudeListenerSet* _listeners;
+        AZ::u64 _frame;
+    };
+} // namespace Audio
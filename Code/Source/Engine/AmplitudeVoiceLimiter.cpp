@@ -0,0 +1,408 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+
+#include <Engine/AmplitudeVoiceLimiter.h>
+
+namespace Audio
+{
+    // A virtual event only takes the place of a real one when its score is higher by this factor,
+    // so that events with close scores don't keep swapping.
+    static constexpr float kVoiceSwapHysteresis = 1.25f;
+
+    static bool IsEventRunning(const EventCanceler& canceler)
+    {
+        return canceler.Valid() && canceler.GetEvent()->IsRunning();
+    }
+
+    AmplitudeVoiceLimiter::AmplitudeVoiceLimiter(
+        AmplitudeListenerSet* const listeners, AmplitudeAudioInputSourceManager* const audioInputSources)
+        : _realVoiceCount(0)
+        , _maxRealVoices(DefaultMaxRealVoices)
+        , _maxVirtualTime(DefaultMaxVirtualTime)
+        , _distanceReference(DefaultDistanceReference)
+        , _globalEntityId(kAmInvalidObjectId)
+        , _listeners(listeners)
+        , _audioInputSources(audioInputSources)
+    {
+    }
+
+    void AmplitudeVoiceLimiter::SetMaxRealVoices(const AZ::u32 maxRealVoices)
+    {
+        _maxRealVoices = AZStd::max(maxRealVoices, 1u);
+    }
+
+    void AmplitudeVoiceLimiter::SetMaxVirtualTime(const AmTime maxVirtualTime)
+    {
+        _maxVirtualTime = AZStd::max(maxVirtualTime, 0.0);
+    }
+
+    void AmplitudeVoiceLimiter::SetDistanceReference(const float distanceReference)
+    {
+        _distanceReference = AZStd::max(distanceReference, 0.001f);
+    }
+
+    void AmplitudeVoiceLimiter::SetGlobalEntityId(const AmEntityID entityId)
+    {
+        _globalEntityId = entityId;
+    }
+
+    bool AmplitudeVoiceLimiter::Play(
+        Engine* const engine,
+        SATLEventData_Amplitude* const eventData,
+        const AmEventID eventId,
+        const AmEntityID entityId,
+        const float priority,
+        const AmTime duration)
+    {
+        SVoice voice{ eventData, eventId, entityId, priority, ComputeScore(engine, entityId, priority), duration, 0.0, 0.0, true };
+
+        if (_realVoiceCount >= _maxRealVoices)
+        {
+            // Steal the voice of the weakest real event, if the new one is more relevant.
+            if (auto weakest = FindWeakestRealVoice(); weakest != _voices.end() && weakest->fScore < voice.fScore)
+            {
+                Virtualize(*weakest);
+            }
+        }
+
+        if (_realVoiceCount < _maxRealVoices && !Realize(engine, voice))
+        {
+            return false;
+        }
+
+        eventData->audioEventState = eAES_PLAYING;
+        _voices.push_back(voice);
+
+        return true;
+    }
+
+    bool AmplitudeVoiceLimiter::Stop(const SATLEventData_Amplitude* const eventData)
+    {
+        const auto it = FindVoice(eventData);
+        if (it == _voices.end())
+        {
+            return false;
+        }
+
+        if (!it->bIsVirtual && it->pEventData->eventCanceler.Valid())
+        {
+            it->pEventData->eventCanceler.Cancel();
+        }
+
+        RemoveVoice(it);
+        return true;
+    }
+
+    void AmplitudeVoiceLimiter::Forget(const SATLEventData_Amplitude* const eventData)
+    {
+        if (const auto it = FindVoice(eventData); it != _voices.end())
+        {
+            RemoveVoice(it);
+        }
+    }
+
+    void AmplitudeVoiceLimiter::ForgetEntity(const AmEntityID entityId)
+    {
+        for (auto it = _voices.begin(); it != _voices.end();)
+        {
+            if (it->nAmEntityID == entityId)
+            {
+                RemoveVoice(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void AmplitudeVoiceLimiter::ForgetEntities(const TAmUniqueIDVector& sortedEntityIds)
+    {
+        for (auto it = _voices.begin(); it != _voices.end();)
+        {
+            if (AZStd::binary_search(sortedEntityIds.begin(), sortedEntityIds.end(), it->nAmEntityID))
+            {
+                RemoveVoice(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void AmplitudeVoiceLimiter::Update(Engine* const engine, const AmTime deltaTime)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        for (auto it = _voices.begin(); it != _voices.end();)
+        {
+            it->fPlayTime += deltaTime;
+
+            if (it->bIsVirtual)
+            {
+                it->fVirtualTime += deltaTime;
+
+                // Give up on the event once it would have ended. Without a duration, it may be a loop, so it is only
+                // given up when the project opted in for a maximum virtual time.
+                const bool hasEnded = it->fDuration > 0.0 && it->fPlayTime >= it->fDuration;
+                const bool hasExpired = _maxVirtualTime > 0.0 && it->fVirtualTime > _maxVirtualTime;
+
+                if (hasEnded || hasExpired)
+                {
+                    it->pEventData->audioEventState = eAES_NONE;
+                    RemoveVoice(it);
+                    continue;
+                }
+            }
+            else if (!IsEventRunning(it->pEventData->eventCanceler))
+            {
+                it->pEventData->audioEventState = eAES_NONE;
+                RemoveVoice(it);
+                continue;
+            }
+
+            const AmplitudeListenerSet::SListener* nearestListener = nullptr;
+            it->fScore = ComputeScore(engine, it->nAmEntityID, it->fPriority, &nearestListener);
+
+            if (!it->bIsVirtual && nearestListener != nullptr)
+            {
+                _listeners->CountVoice(nearestListener->nAmListenerID);
+            }
+
+            ++it;
+        }
+
+        while (true)
+        {
+            auto strongest = FindStrongestVirtualVoice();
+            if (strongest == _voices.end())
+            {
+                break;
+            }
+
+            if (_realVoiceCount >= _maxRealVoices)
+            {
+                auto weakest = FindWeakestRealVoice();
+                if (weakest == _voices.end() || strongest->fScore <= weakest->fScore * kVoiceSwapHysteresis)
+                {
+                    break;
+                }
+
+                Virtualize(*weakest);
+            }
+
+            if (!Realize(engine, *strongest))
+            {
+                // The event can't be played anymore, most likely its entity or bank is gone.
+                strongest->pEventData->audioEventState = eAES_NONE;
+                RemoveVoice(strongest);
+            }
+        }
+    }
+
+    void AmplitudeVoiceLimiter::Clear()
+    {
+        _voices.clear();
+        _realVoiceCount = 0;
+    }
+
+    void AmplitudeVoiceLimiter::GetRealVoiceScores(TEntityScoreMap& scores) const
+    {
+        scores.clear();
+
+        for (const auto& voice : _voices)
+        {
+            if (!voice.bIsVirtual)
+            {
+                float& score = scores[voice.nAmEntityID];
+                score = AZStd::max(score, voice.fScore);
+            }
+        }
+    }
+
+    void AmplitudeVoiceLimiter::GetRealVoiceEntities(AZStd::vector<AmEntityID, AudioImplStdAllocator>& entities) const
+    {
+        entities.clear();
+
+        for (const auto& voice : _voices)
+        {
+            if (!voice.bIsVirtual)
+            {
+                entities.push_back(voice.nAmEntityID);
+            }
+        }
+    }
+
+    void AmplitudeVoiceLimiter::GetEventVoiceCounts(AZStd::vector<AZStd::pair<AmEventID, AZ::u32>>& counts) const
+    {
+        counts.clear();
+
+        for (const auto& voice : _voices)
+        {
+            if (voice.bIsVirtual)
+            {
+                continue;
+            }
+
+            const auto it = AZStd::find_if(
+                counts.begin(),
+                counts.end(),
+                [&voice](const AZStd::pair<AmEventID, AZ::u32>& count)
+                {
+                    return count.first == voice.nAmEventID;
+                });
+
+            if (it != counts.end())
+            {
+                ++it->second;
+            }
+            else
+            {
+                counts.emplace_back(voice.nAmEventID, 1u);
+            }
+        }
+    }
+
+    float AmplitudeVoiceLimiter::ComputeScore(
+        Engine* const engine,
+        const AmEntityID entityId,
+        const float priority,
+        const AmplitudeListenerSet::SListener** const nearestListener) const
+    {
+        float distance = 0.0f;
+
+        // The global entity has no meaningful position, it stays at the origin whatever the listeners do.
+        if (entityId == _globalEntityId)
+        {
+            return priority;
+        }
+
+        if (const Entity entity = engine->GetEntity(entityId); entity.Valid())
+        {
+            if (const AmplitudeListenerSet::SListener* listener = _listeners->FindNearest(entity.GetLocation()))
+            {
+                distance = HMM_LengthVec3(HMM_SubtractVec3(entity.GetLocation(), listener->vLocation));
+
+                if (nearestListener != nullptr)
+                {
+                    *nearestListener = listener;
+                }
+            }
+        }
+
+        return priority * _distanceReference / (_distanceReference + distance);
+    }
+
+    bool AmplitudeVoiceLimiter::Realize(Engine* const engine, SVoice& voice)
+    {
+        const EventHandle event = engine->GetEventHandle(voice.nAmEventID);
+        if (event == nullptr)
+        {
+            AZLOG_WARN(
+                "[Amplitude] Unable to activate a trigger, the associated Amplitude event with ID %llu has not been found in loaded "
+                "banks.",
+                static_cast<unsigned long long>(voice.nAmEventID));
+            return false;
+        }
+
+        const EventCanceler canceler = engine->Trigger(event, engine->GetEntity(voice.nAmEntityID));
+        if (!canceler.Valid())
+        {
+            return false;
+        }
+
+        // Amplitude opens the decoder of an audio input sound when the event is triggered for real, not while virtual.
+        if (voice.pEventData->nSourceId != INVALID_AUDIO_SOURCE_ID)
+        {
+            _audioInputSources->StartBinding(voice.pEventData->nATLID);
+        }
+
+        voice.pEventData->eventCanceler = canceler;
+        voice.bIsVirtual = false;
+        voice.fVirtualTime = 0.0;
+        ++_realVoiceCount;
+
+        return true;
+    }
+
+    void AmplitudeVoiceLimiter::Virtualize(SVoice& voice)
+    {
+        if (voice.pEventData->eventCanceler.Valid())
+        {
+            voice.pEventData->eventCanceler.Cancel();
+        }
+
+        voice.pEventData->eventCanceler = EventCanceler(nullptr);
+        voice.bIsVirtual = true;
+        --_realVoiceCount;
+    }
+
+    AmplitudeVoiceLimiter::TVoiceVector::iterator AmplitudeVoiceLimiter::FindVoice(const SATLEventData_Amplitude* const eventData)
+    {
+        return AZStd::find_if(
+            _voices.begin(),
+            _voices.end(),
+            [eventData](const SVoice& voice)
+            {
+                return voice.pEventData == eventData;
+            });
+    }
+
+    AmplitudeVoiceLimiter::TVoiceVector::iterator AmplitudeVoiceLimiter::FindWeakestRealVoice()
+    {
+        auto weakest = _voices.end();
+
+        for (auto it = _voices.begin(); it != _voices.end(); ++it)
+        {
+            if (!it->bIsVirtual && (weakest == _voices.end() || it->fScore < weakest->fScore))
+            {
+                weakest = it;
+            }
+        }
+
+        return weakest;
+    }
+
+    AmplitudeVoiceLimiter::TVoiceVector::iterator AmplitudeVoiceLimiter::FindStrongestVirtualVoice()
+    {
+        auto strongest = _voices.end();
+
+        for (auto it = _voices.begin(); it != _voices.end(); ++it)
+        {
+            if (it->bIsVirtual && (strongest == _voices.end() || it->fScore > strongest->fScore))
+            {
+                strongest = it;
+            }
+        }
+
+        return strongest;
+    }
+
+    void AmplitudeVoiceLimiter::RemoveVoice(const TVoiceVector::iterator it)
+    {
+        if (!it->bIsVirtual)
+        {
+            --_realVoiceCount;
+        }
+
+        // Order doesn't matter, swap with the last voice to avoid shifting the whole vector.
+        *it = _voices.back();
+        _voices.pop_back();
+    }
+} // namespace Audio
@@ -0,0 +1,147 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <AudioAllocators.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <Engine/ATLEntities_amplitude.h>
+#include <Engine/AmplitudeAudioInputSource.h>
+#include <Engine/AmplitudeListenerSet.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+namespace Audio
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Keeps the number of events mixed by Amplitude within a voice budget.
+    //!
+    //! Each played event gets a score from its trigger priority and its distance to the nearest listener.
+    //! When the budget is exhausted, the lowest scored events become virtual: they are not triggered in
+    //! Amplitude, but their play time is still tracked. Virtual events are triggered again as soon as they
+    //! outscore a real one, or when a real voice becomes available.
+    //!
+    //! A virtual event is given up once its play time reaches the duration set on its trigger. Events without a
+    //! duration, like loops, stay virtual until they are stopped, unless a maximum virtual time is set.
+    class AmplitudeVoiceLimiter
+    {
+    public:
+        static constexpr AZ::u32 DefaultMaxRealVoices = 64;
+        // Disabled by default, so looping events are never dropped while virtual.
+        static constexpr AmTime DefaultMaxVirtualTime = 0.0;
+        static constexpr float DefaultDistanceReference = 10.0f;
+
+        using TEntityScoreMap =
+            AZStd::unordered_map<AmEntityID, float, AZStd::hash<AmEntityID>, AZStd::equal_to<AmEntityID>, AudioImplStdAllocator>;
+
+        //! @param audioInputSources Told when an event playing an audio input source is triggered in Amplitude.
+        AmplitudeVoiceLimiter(AmplitudeListenerSet* listeners, AmplitudeAudioInputSourceManager* audioInputSources);
+
+        void SetMaxRealVoices(AZ::u32 maxRealVoices);
+
+        //! Sets the time after which virtual events without a duration are given up, or zero to keep them until stopped.
+        void SetMaxVirtualTime(AmTime maxVirtualTime);
+        void SetDistanceReference(float distanceReference);
+
+        //! Sets the entity playing the events of the global and non-positional audio objects. Its events are always
+        //! scored as if they were played at the listener position.
+        void SetGlobalEntityId(AmEntityID entityId);
+
+        //! Plays the event on the given entity, either for real or virtually if the voice budget is exhausted.
+        //! @param duration The expected duration of the event, or zero if unknown or looping.
+        //! @return Whether the event is now tracked, real or virtual.
+        bool Play(
+            Engine* engine, SATLEventData_Amplitude* eventData, AmEventID eventId, AmEntityID entityId, float priority, AmTime duration);
+
+        //! Stops tracking the given event, cancelling it in Amplitude if it was real.
+        //! @return Whether the event was tracked by the limiter.
+        bool Stop(const SATLEventData_Amplitude* eventData);
+
+        //! Stops tracking the given event without touching its Amplitude state.
+        void Forget(const SATLEventData_Amplitude* eventData);
+
+        //! Forgets all the events played on the given entity.
+        void ForgetEntity(AmEntityID entityId);
+
+        //! Forgets all the events played on the given entities, sorted in ascending order, in a single pass.
+        void ForgetEntities(const TAmUniqueIDVector& sortedEntityIds);
+
+        //! Drops the finished events, updates the scores, and swaps real and virtual events when needed.
+        //! Real voices are attributed to their nearest listener.
+        void Update(Engine* engine, AmTime deltaTime);
+
+        void Clear();
+
+        //! Gets the highest score of the real events played on each audible entity, in a single pass.
+        void GetRealVoiceScores(TEntityScoreMap& scores) const;
+
+        //! Gets the entities playing at least one real event. An entity is listed once per real event.
+        void GetRealVoiceEntities(AZStd::vector<AmEntityID, AudioImplStdAllocator>& entities) const;
+
+        //! Gets the number of real voices played by each event.
+        void GetEventVoiceCounts(AZStd::vector<AZStd::pair<AmEventID, AZ::u32>>& counts) const;
+
+        [[nodiscard]] AZ::u32 GetRealVoiceCount() const
+        {
+            return _realVoiceCount;
+        }
+
+        [[nodiscard]] AZ::u32 GetVirtualVoiceCount() const
+        {
+            return static_cast<AZ::u32>(_voices.size()) - _realVoiceCount;
+        }
+
+    private:
+        struct SVoice
+        {
+            SATLEventData_Amplitude* pEventData;
+            AmEventID nAmEventID;
+            AmEntityID nAmEntityID;
+            float fPriority;
+            float fScore;
+            AmTime fDuration;
+            AmTime fPlayTime;
+            AmTime fVirtualTime;
+            bool bIsVirtual;
+        };
+
+        using TVoiceVector = AZStd::vector<SVoice, AudioImplStdAllocator>;
+
+        [[nodiscard]] float ComputeScore(
+            Engine* engine, AmEntityID entityId, float priority, const AmplitudeListenerSet::SListener** nearestListener = nullptr) const;
+
+        bool Realize(Engine* engine, SVoice& voice);
+        void Virtualize(SVoice& voice);
+
+        TVoiceVector::iterator FindVoice(const SATLEventData_Amplitude* eventData);
+        TVoiceVector::iterator FindWeakestRealVoice();
+        TVoiceVector::iterator FindStrongestVirtualVoice();
+
+        void RemoveVoice(TVoiceVector::iterator it);
+
+        TVoiceVector _voices;
+        AZ::u32 _realVoiceCount;
+        AZ::u32 _maxRealVoices;
+        AmTime _maxVirtualTime;
+        float _distanceReference;
+        AmEntityID _globalEntityId;
+        AmplitudeListenerSet* _listeners;
+        AmplitudeAudioInputSourceManager* _audioInputSources;
+    };
+} // namespace Audio
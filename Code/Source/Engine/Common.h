@@ -36,6 +36,10 @@ namespace SparkyStudios::Audio::Amplitude
         static constexpr char kIdAttribute[] = "amplitude_id";
         static constexpr char kNameAttribute[] = "amplitude_name";
         static constexpr char kValueAttribute[] = "amplitude_value";
+        static constexpr char kPriorityAttribute[] = "amplitude_priority";
+        static constexpr char kCoalescingWindowAttribute[] = "amplitude_coalescing_window";
+        static constexpr char kMaxInstancesAttribute[] = "amplitude_max_instances";
+        static constexpr char kDurationAttribute[] = "amplitude_duration";
         static constexpr char kMultiplierAttribute[] = "atl_multiplier";
         static constexpr char kShiftAttribute[] = "atl_shift";
     } // namespace XmlTags
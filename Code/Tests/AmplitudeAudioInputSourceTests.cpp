@@ -0,0 +1,219 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Engine/AmplitudeAudioInputSource.h>
+
+namespace Audio::Tests
+{
+    static constexpr TAudioSourceId kFirstSourceId = 1;
+    static constexpr TAudioSourceId kSecondSourceId = 2;
+    static constexpr TAudioEventID kFirstEventId = 10;
+    static constexpr TAudioEventID kSecondEventId = 11;
+    static constexpr AZ::u32 kChannelCount = 2;
+
+    //! Plays audio input sources the way the Amplitude mixer does: the trigger binds the source, the voice limiter starts
+    //! the binding when the event gets a real voice, and the decoder of the sound is opened when the engine advances its frame.
+    class AmplitudeAudioInputSourceTest : public UnitTest::AllocatorsTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsTestFixture::SetUp();
+
+            AudioImplAllocator::Descriptor allocDesc;
+            allocDesc.m_heap.m_numFixedMemoryBlocks = 1;
+            allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0] = 8 << 20;
+            allocDesc.m_heap.m_fixedMemoryBlocks[0] = AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(
+                allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0], allocDesc.m_heap.m_memoryBlockAlignment);
+
+            AZ::AllocatorInstance<AudioImplAllocator>::Create(allocDesc);
+
+            _sources = AZStd::make_unique<AmplitudeAudioInputSourceManager>();
+            _codec = AZStd::make_unique<AmplitudeAudioInputCodec>(_sources.get());
+
+            EXPECT_TRUE(_sources->CreateSource(MakeSourceConfig(kFirstSourceId)));
+            EXPECT_TRUE(_sources->CreateSource(MakeSourceConfig(kSecondSourceId)));
+        }
+
+        void TearDown() override
+        {
+            _codec.reset();
+            _sources->DestroyAllSources();
+            _sources.reset();
+
+            AZ::AllocatorInstance<AudioImplAllocator>::Destroy();
+
+            UnitTest::AllocatorsTestFixture::TearDown();
+        }
+
+        static SAudioInputConfig MakeSourceConfig(const TAudioSourceId sourceId)
+        {
+            SAudioInputConfig config;
+            config.m_sourceId = sourceId;
+            config.m_sourceType = AudioInputSourceType::ExternalStream;
+            config.m_sampleType = AudioInputSampleType::Float;
+            config.m_sampleRate = 48000;
+            config.m_numChannels = kChannelCount;
+            config.m_bitsPerSample = 32;
+            return config;
+        }
+
+        //! Pushes one frame of the given value through the streaming bus, as a game producer does.
+        static void PushFrame(const TAudioSourceId sourceId, float value)
+        {
+            AZStd::array<float, kChannelCount> frame;
+            frame.fill(value);
+
+            AudioStreamData data(reinterpret_cast<AZ::u8*>(frame.data()), sizeof(frame));
+
+            AZStd::size_t bytesWritten = 0;
+            AudioStreamingRequestBus::EventResult(bytesWritten, sourceId, &AudioStreamingRequestBus::Events::ReadStreamingInput, data);
+            EXPECT_EQ(bytesWritten, sizeof(frame));
+        }
+
+        //! Opens a decoder the way the mixer does for a new voice, and streams one frame from it.
+        float OpenAndStreamFrame(AmplitudeAudioInputCodec::Decoder& decoder) const
+        {
+            EXPECT_TRUE(decoder.Open(AM_OS_STRING("voice.amsource")));
+
+            AZStd::array<float, kChannelCount> frame;
+            frame.fill(-1.0f);
+            EXPECT_EQ(decoder.Stream(frame.data(), 0, 0, 1), 1u);
+
+            return frame[0];
+        }
+
+        AZStd::unique_ptr<AmplitudeAudioInputSourceManager> _sources;
+        AZStd::unique_ptr<AmplitudeAudioInputCodec> _codec;
+    };
+
+    TEST_F(AmplitudeAudioInputSourceTest, Decoder_OpenedAfterTrigger_StreamsBoundSource)
+    {
+        // The trigger succeeded, so the binding is not dropped when ActivateTrigger returns.
+        ASSERT_TRUE(_sources->BindSource(kFirstSourceId, kFirstEventId));
+        _sources->StartBinding(kFirstEventId);
+
+        PushFrame(kFirstSourceId, 0.25f);
+
+        AmplitudeAudioInputCodec::Decoder decoder(_codec.get(), _sources.get());
+        EXPECT_FLOAT_EQ(OpenAndStreamFrame(decoder), 0.25f);
+        EXPECT_EQ(_sources->GetPendingBindingCount(), 0u);
+
+        decoder.Close();
+    }
+
+    TEST_F(AmplitudeAudioInputSourceTest, Decoders_OpenedInTheSameFrame_StreamTheirOwnSource)
+    {
+        ASSERT_TRUE(_sources->BindSource(kFirstSourceId, kFirstEventId));
+        ASSERT_TRUE(_sources->BindSource(kSecondSourceId, kSecondEventId));
+        _sources->StartBinding(kFirstEventId);
+        _sources->StartBinding(kSecondEventId);
+
+        PushFrame(kFirstSourceId, 0.25f);
+        PushFrame(kSecondSourceId, 0.75f);
+
+        AmplitudeAudioInputCodec::Decoder firstDecoder(_codec.get(), _sources.get());
+        AmplitudeAudioInputCodec::Decoder secondDecoder(_codec.get(), _sources.get());
+
+        EXPECT_FLOAT_EQ(OpenAndStreamFrame(firstDecoder), 0.25f);
+        EXPECT_FLOAT_EQ(OpenAndStreamFrame(secondDecoder), 0.75f);
+
+        firstDecoder.Close();
+        secondDecoder.Close();
+    }
+
+    TEST_F(AmplitudeAudioInputSourceTest, Event_StoppedBeforeDecoderOpened_DoesNotLeakItsSource)
+    {
+        ASSERT_TRUE(_sources->BindSource(kFirstSourceId, kFirstEventId));
+        ASSERT_TRUE(_sources->BindSource(kSecondSourceId, kSecondEventId));
+
+        _sources->StartBinding(kFirstEventId);
+        _sources->StartBinding(kSecondEventId);
+
+        _sources->UnbindSource(kFirstEventId);
+
+        PushFrame(kFirstSourceId, 0.25f);
+        PushFrame(kSecondSourceId, 0.75f);
+
+        AmplitudeAudioInputCodec::Decoder decoder(_codec.get(), _sources.get());
+        EXPECT_FLOAT_EQ(OpenAndStreamFrame(decoder), 0.75f);
+
+        decoder.Close();
+    }
+
+    TEST_F(AmplitudeAudioInputSourceTest, Source_DestroyedBeforeDecoderOpened_DropsItsBinding)
+    {
+        ASSERT_TRUE(_sources->BindSource(kFirstSourceId, kFirstEventId));
+        _sources->StartBinding(kFirstEventId);
+
+        _sources->DestroySource(kFirstSourceId);
+        EXPECT_EQ(_sources->GetPendingBindingCount(), 0u);
+
+        AmplitudeAudioInputCodec::Decoder decoder(_codec.get(), _sources.get());
+        EXPECT_FALSE(decoder.Open(AM_OS_STRING("voice.amsource")));
+    }
+
+    TEST_F(AmplitudeAudioInputSourceTest, Events_StartedInAnotherOrderThanBound_StreamTheirOwnSource)
+    {
+        // The first event is played virtually, so the second one is triggered in Amplitude before it.
+        ASSERT_TRUE(_sources->BindSource(kFirstSourceId, kFirstEventId));
+        ASSERT_TRUE(_sources->BindSource(kSecondSourceId, kSecondEventId));
+        _sources->StartBinding(kSecondEventId);
+
+        PushFrame(kFirstSourceId, 0.25f);
+        PushFrame(kSecondSourceId, 0.75f);
+
+        AmplitudeAudioInputCodec::Decoder secondDecoder(_codec.get(), _sources.get());
+        EXPECT_FLOAT_EQ(OpenAndStreamFrame(secondDecoder), 0.75f);
+        EXPECT_EQ(_sources->GetPendingBindingCount(), 1u);
+
+        // The first event gets a real voice in a later frame.
+        _sources->ResetStartedBindings();
+        _sources->StartBinding(kFirstEventId);
+
+        AmplitudeAudioInputCodec::Decoder firstDecoder(_codec.get(), _sources.get());
+        EXPECT_FLOAT_EQ(OpenAndStreamFrame(firstDecoder), 0.25f);
+        EXPECT_EQ(_sources->GetPendingBindingCount(), 0u);
+
+        firstDecoder.Close();
+        secondDecoder.Close();
+    }
+
+    TEST_F(AmplitudeAudioInputSourceTest, Event_StartedWithoutOpeningDecoder_DoesNotTakeTheSourceOfTheNextEvent)
+    {
+        ASSERT_TRUE(_sources->BindSource(kFirstSourceId, kFirstEventId));
+        _sources->StartBinding(kFirstEventId);
+
+        // The engine frame ended without opening a decoder for the first event.
+        _sources->ResetStartedBindings();
+
+        ASSERT_TRUE(_sources->BindSource(kSecondSourceId, kSecondEventId));
+        _sources->StartBinding(kSecondEventId);
+
+        PushFrame(kFirstSourceId, 0.25f);
+        PushFrame(kSecondSourceId, 0.75f);
+
+        AmplitudeAudioInputCodec::Decoder decoder(_codec.get(), _sources.get());
+        EXPECT_FLOAT_EQ(OpenAndStreamFrame(decoder), 0.75f);
+        EXPECT_EQ(_sources->GetPendingBindingCount(), 1u);
+
+        decoder.Close();
+    }
+} // namespace Audio::Tests
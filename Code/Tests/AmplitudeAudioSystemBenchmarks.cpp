@@ -0,0 +1,764 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/XML/rapidxml.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzFramework/Platform/PlatformDefaults.h>
+
+#include <benchmark/benchmark.h>
+
+#include <Config.h>
+#include <Engine/AmplitudeAudioSystem.h>
+#include <Engine/AmplitudeControlCache.h>
+#include <Engine/Common.h>
+
+namespace Audio::Benchmarks
+{
+    using namespace SparkyStudios::Audio::Amplitude;
+
+    // Objects looked up in the loaded banks of the project. Benchmarks needing them are skipped when they are missing.
+    static constexpr char kBenchmarkBankFile[] = "benchmark.ambank";
+    static constexpr char kBenchmarkEventName[] = "benchmark_event";
+    static constexpr char kBenchmarkRtpcName[] = "benchmark_rtpc";
+    static constexpr char kBenchmarkEnvironmentName[] = "benchmark_environment";
+
+    // Folder of the control cache files written by the connection parsing benchmarks.
+    static constexpr char kBenchmarkControlCacheFolder[] = "@user@/Amplitude/benchmark";
+
+    // Number of control cache files loaded at initialization by the cache loading benchmark.
+    static constexpr size_t kControlCacheFileCount = 32;
+
+    // Number of registered audio objects each benchmark runs against.
+    static constexpr int64_t kMinEntityCount = 16;
+    static constexpr int64_t kMaxEntityCount = 4096;
+
+    // Number of audio objects streamed in and out by the churn benchmarks.
+    static constexpr int64_t kChurnEntityCount = 10000;
+
+    // Number of playing voices the send ramps are updated against.
+    static constexpr int64_t kSendRampVoiceCount = 1000;
+
+    // Interval of the audio thread updates, in milliseconds.
+    static constexpr float kUpdateIntervalMs = 16.0f;
+
+    //! Loads the control cache from the benchmark folder instead of the products of the project.
+    class BenchmarkAudioSystem : public AmplitudeAudioSystem
+    {
+    public:
+        using AmplitudeAudioSystem::AmplitudeAudioSystem;
+        using AmplitudeAudioSystem::LoadControlCache;
+    };
+
+    //! Drives AmplitudeAudioSystem directly, the way the ATL does from the audio thread.
+    class AmplitudeAudioSystemBenchmark : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            if (!AZ::AllocatorInstance<AudioImplAllocator>::IsReady())
+            {
+                AudioImplAllocator::Descriptor allocDesc;
+                allocDesc.m_heap.m_numFixedMemoryBlocks = 1;
+                allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0] = 131072 << 10;
+                allocDesc.m_heap.m_fixedMemoryBlocks[0] = AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(
+                    allocDesc.m_heap.m_fixedMemoryBlocksByteSize[0], allocDesc.m_heap.m_memoryBlockAlignment);
+
+                AZ::AllocatorInstance<AudioImplAllocator>::Create(allocDesc);
+            }
+
+            const AZStd::string assetPlatform = AzFramework::OSPlatformToDefaultAssetPlatform(AZ_TRAIT_OS_PLATFORM_CODENAME);
+            _system = AZStd::make_unique<BenchmarkAudioSystem>(assetPlatform.c_str());
+            _isInitialized = _system->Initialize() == EAudioRequestStatus::Success;
+
+            if (!_isInitialized)
+            {
+                return;
+            }
+
+            const auto entityCount = static_cast<size_t>(state.range(0));
+            _objects.reserve(entityCount);
+            _events.reserve(entityCount);
+
+            for (size_t i = 0; i < entityCount; ++i)
+            {
+                // ID 0 is the invalid object ID.
+                _objects.push_back(_system->NewAudioObjectData(static_cast<TAudioObjectID>(i + 1)));
+                _events.push_back(_system->NewAudioEventData(static_cast<TAudioEventID>(i + 1)));
+            }
+        }
+
+        void InternalTearDown(const benchmark::State& state)
+        {
+            if (_system)
+            {
+                for (IATLEventData* const eventData : _events)
+                {
+                    _system->DeleteAudioEventData(eventData);
+                }
+
+                for (SATLAudioObjectData_Amplitude* const objectData : _objects)
+                {
+                    _system->DeleteAudioObjectData(objectData);
+                }
+
+                _events.clear();
+                _objects.clear();
+
+                _system->ShutDown();
+                _system->Release();
+                _system.reset();
+            }
+
+            if (AZ::AllocatorInstance<AudioImplAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AudioImplAllocator>::Destroy();
+            }
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        bool SkipIfNotInitialized(benchmark::State& state) const
+        {
+            if (!_isInitialized)
+            {
+                state.SkipWithError("The Amplitude engine failed to initialize.");
+                return true;
+            }
+
+            return false;
+        }
+
+        void RegisterObjects()
+        {
+            for (SATLAudioObjectData_Amplitude* const objectData : _objects)
+            {
+                _system->RegisterAudioObject(objectData, nullptr);
+            }
+        }
+
+        void UnregisterObjects()
+        {
+            for (SATLAudioObjectData_Amplitude* const objectData : _objects)
+            {
+                _system->UnregisterAudioObject(objectData);
+            }
+        }
+
+        //! Registers and unregisters all the objects on each iteration, and reports the entities processed per second
+        //! along with the memory held by the audio allocator: at its peak while the objects are registered, and after
+        //! they are all unregistered, which should not grow with the iterations.
+        template<typename TRegister, typename TUnregister>
+        void RunEntityChurn(benchmark::State& state, const TRegister& registerObjects, const TUnregister& unregisterObjects) const
+        {
+            auto& allocator = AZ::AllocatorInstance<AudioImplAllocator>::Get();
+
+            const size_t initialBytes = allocator.NumAllocatedBytes();
+            size_t peakBytes = initialBytes;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                registerObjects();
+
+                state.PauseTiming();
+                peakBytes = AZStd::max(peakBytes, allocator.NumAllocatedBytes());
+                state.ResumeTiming();
+
+                unregisterObjects();
+            }
+
+            const auto entityCount = static_cast<int64_t>(_objects.size());
+
+            // Each entity is registered then unregistered once per iteration.
+            state.SetItemsProcessed(state.iterations() * entityCount * 2);
+            state.counters["entities_per_second"] =
+                benchmark::Counter(static_cast<double>(entityCount), benchmark::Counter::kIsIterationInvariantRate);
+            state.counters["peak_bytes"] = static_cast<double>(peakBytes - initialBytes);
+            state.counters["retained_bytes"] = static_cast<double>(allocator.NumAllocatedBytes()) - static_cast<double>(initialBytes);
+            state.counters["bytes_per_entity"] = static_cast<double>(peakBytes - initialBytes) / static_cast<double>(entityCount);
+        }
+
+        //! Reports the number of calls per second, and the average time of a call.
+        void SetCallCounters(benchmark::State& state) const
+        {
+            const auto callCount = static_cast<int64_t>(_objects.size());
+
+            state.SetItemsProcessed(state.iterations() * callCount);
+            state.counters["call_time"] = benchmark::Counter(
+                static_cast<double>(callCount), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+        }
+
+        //! Builds a control file with one event connection per audio object. Connections differ by their priority, so
+        //! that each one gets its own cache entry. Control files built with different offsets share no connection.
+        void BuildEventConnections(const AmEventID eventId, AZ::rapidxml::xml_document<char>& doc, const size_t priorityOffset = 0) const
+        {
+            AZStd::string controls = "<AudioControls>";
+
+            for (size_t i = 0; i < _objects.size(); ++i)
+            {
+                controls += AZStd::string::format(
+                    R"(<%s %s="%llu" %s="%s" %s="%zu"/>)", XmlTags::kEventTag, XmlTags::kIdAttribute,
+                    static_cast<unsigned long long>(eventId), XmlTags::kNameAttribute, kBenchmarkEventName, XmlTags::kPriorityAttribute,
+                    priorityOffset + i);
+            }
+
+            controls += "</AudioControls>";
+            doc.parse<AZ::rapidxml::parse_no_data_nodes>(doc.allocate_string(controls.c_str()));
+        }
+
+        //! Writes the control cache file of the given index in the benchmark folder.
+        static bool WriteControlCacheFile(const char* folderPath, const size_t index, const AZStd::vector<AZ::u8>& cacheData)
+        {
+            const AZStd::string cachePath = AZStd::string::format("%s/controls_%zu%s", folderPath, index, kControlCacheFileExtension);
+
+            AZ::IO::SystemFile file;
+            constexpr int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH |
+                AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+
+            return file.Open(cachePath.c_str(), openMode) && file.Write(cacheData.data(), cacheData.size()) == cacheData.size();
+        }
+
+        //! Resolves the benchmark folder, after removing the cache files left by a previous benchmark.
+        static bool ResolveControlCacheFolder(char (&folderPath)[AZ_MAX_PATH_LEN])
+        {
+            AZ::IO::FileIOBase* const fileIO = AZ::IO::FileIOBase::GetInstance();
+            if (fileIO == nullptr || !fileIO->ResolvePath(kBenchmarkControlCacheFolder, folderPath, AZ_MAX_PATH_LEN))
+            {
+                return false;
+            }
+
+            DeleteControlCacheFolder(folderPath);
+            return true;
+        }
+
+        static void DeleteControlCacheFolder(const char* folderPath)
+        {
+            if (AZ::IO::FileIOBase* const fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO != nullptr && fileIO->IsDirectory(folderPath))
+            {
+                fileIO->DestroyPath(folderPath);
+            }
+        }
+
+        AZStd::unique_ptr<BenchmarkAudioSystem> _system;
+        AZStd::vector<SATLAudioObjectData_Amplitude*> _objects;
+        AZStd::vector<IATLEventData*> _events;
+        bool _isInitialized = false;
+    };
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, RegisterAudioObject)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            RegisterObjects();
+
+            state.PauseTiming();
+            UnregisterObjects();
+            state.ResumeTiming();
+        }
+
+        SetCallCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, EntityChurn)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        RunEntityChurn(
+            state,
+            [this]()
+            {
+                RegisterObjects();
+            },
+            [this]()
+            {
+                UnregisterObjects();
+            });
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, EntityChurnBatched)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const AZStd::vector<IATLAudioObjectData*> audioObjects(_objects.begin(), _objects.end());
+
+        RunEntityChurn(
+            state,
+            [this, &audioObjects]()
+            {
+                _system->RegisterAudioObjects(audioObjects);
+            },
+            [this, &audioObjects]()
+            {
+                _system->UnregisterAudioObjects(audioObjects);
+            });
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, SetPosition)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        RegisterObjects();
+
+        float offset = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < _objects.size(); ++i)
+            {
+                const SATLWorldPosition position(AZ::Vector3(static_cast<float>(i), offset, 0.0f));
+                _system->SetPosition(_objects[i], position);
+            }
+
+            offset += 0.1f;
+        }
+
+        UnregisterObjects();
+        SetCallCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, SetRtpc)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const RtpcHandle rtpc = Engine::GetInstance()->GetRtpcHandle(kBenchmarkRtpcName);
+        if (rtpc == nullptr)
+        {
+            state.SkipWithError("The benchmark RTPC is not in the loaded banks.");
+            return;
+        }
+
+        const SATLRtpcImplData_Amplitude rtpcData(rtpc->GetId());
+
+        RegisterObjects();
+
+        float value = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (SATLAudioObjectData_Amplitude* const objectData : _objects)
+            {
+                _system->SetRtpc(objectData, &rtpcData, value);
+            }
+
+            value = value >= 1.0f ? 0.0f : value + 0.01f;
+        }
+
+        UnregisterObjects();
+        SetCallCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, SetEnvironment)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const EnvironmentHandle environment = Engine::GetInstance()->GetEnvironmentHandle(kBenchmarkEnvironmentName);
+        if (environment == nullptr)
+        {
+            state.SkipWithError("The benchmark environment is not in the loaded banks.");
+            return;
+        }
+
+        const SATLEnvironmentImplData_Amplitude environmentData(eAAET_EFFECT, environment->GetId());
+
+        RegisterObjects();
+
+        float amount = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (SATLAudioObjectData_Amplitude* const objectData : _objects)
+            {
+                _system->SetEnvironment(objectData, &environmentData, amount);
+            }
+
+            amount = amount >= 1.0f ? 0.0f : amount + 0.01f;
+        }
+
+        UnregisterObjects();
+        SetCallCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, UpdateSendRamps)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const EventHandle event = Engine::GetInstance()->GetEventHandle(kBenchmarkEventName);
+        const EnvironmentHandle environment = Engine::GetInstance()->GetEnvironmentHandle(kBenchmarkEnvironmentName);
+        if (event == nullptr || environment == nullptr)
+        {
+            state.SkipWithError("The benchmark event or environment is not in the loaded banks.");
+            return;
+        }
+
+        const SATLTriggerImplData_Amplitude triggerData(event->GetId(), 1.0f, 0.0, 0, 0.0);
+        const SATLEnvironmentImplData_Amplitude environmentData(eAAET_EFFECT, environment->GetId());
+
+        RegisterObjects();
+
+        // Every object plays a voice, so all the sends are audible and applied on each update.
+        for (size_t i = 0; i < _objects.size(); ++i)
+        {
+            _system->ActivateTrigger(_objects[i], &triggerData, _events[i], nullptr);
+        }
+
+        float amount = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            for (SATLAudioObjectData_Amplitude* const objectData : _objects)
+            {
+                _system->SetEnvironment(objectData, &environmentData, amount);
+            }
+
+            amount = amount >= 1.0f ? 0.0f : amount + 0.01f;
+            state.ResumeTiming();
+
+            _system->Update(kUpdateIntervalMs);
+        }
+
+        for (size_t i = 0; i < _objects.size(); ++i)
+        {
+            _system->StopEvent(_objects[i], _events[i]);
+        }
+
+        UnregisterObjects();
+        SetCallCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, ActivateTrigger)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const EventHandle event = Engine::GetInstance()->GetEventHandle(kBenchmarkEventName);
+        if (event == nullptr)
+        {
+            state.SkipWithError("The benchmark event is not in the loaded banks.");
+            return;
+        }
+
+        // No coalescing window, so each activation reaches the voice limiter.
+        const SATLTriggerImplData_Amplitude triggerData(event->GetId(), 1.0f, 0.0, 0, 0.0);
+
+        RegisterObjects();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < _objects.size(); ++i)
+            {
+                _system->ActivateTrigger(_objects[i], &triggerData, _events[i], nullptr);
+            }
+
+            state.PauseTiming();
+            for (size_t i = 0; i < _objects.size(); ++i)
+            {
+                _system->StopEvent(_objects[i], _events[i]);
+            }
+            state.ResumeTiming();
+        }
+
+        UnregisterObjects();
+        SetCallCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, ParseConnectionsFromXml)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const EventHandle event = Engine::GetInstance()->GetEventHandle(kBenchmarkEventName);
+        if (event == nullptr)
+        {
+            state.SkipWithError("The benchmark event is not in the loaded banks.");
+            return;
+        }
+
+        AZ::rapidxml::xml_document<char> doc;
+        BuildEventConnections(event->GetId(), doc);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const auto* node = doc.first_node()->first_node(); node != nullptr; node = node->next_sibling())
+            {
+                IATLTriggerImplData* const triggerData = _system->NewAudioTriggerImplData(node);
+
+                state.PauseTiming();
+                _system->DeleteAudioTriggerImplData(triggerData);
+                state.ResumeTiming();
+            }
+        }
+
+        SetCallCounters(state);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, ParseConnectionsFromCache)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const EventHandle event = Engine::GetInstance()->GetEventHandle(kBenchmarkEventName);
+        if (event == nullptr)
+        {
+            state.SkipWithError("The benchmark event is not in the loaded banks.");
+            return;
+        }
+
+        AZ::rapidxml::xml_document<char> doc;
+        BuildEventConnections(event->GetId(), doc);
+
+        AZStd::vector<AZ::u8> cacheData;
+        AmplitudeControlCache::Build(doc.first_node(), cacheData);
+
+        char cacheFolder[AZ_MAX_PATH_LEN] = { 0 };
+        if (!ResolveControlCacheFolder(cacheFolder) || !WriteControlCacheFile(cacheFolder, 0, cacheData))
+        {
+            state.SkipWithError("The benchmark control cache could not be written.");
+            return;
+        }
+
+        _system->LoadControlCache(cacheFolder);
+
+        // Same work as the XML benchmark, with every connection found in the cache: hashing the node, the lookup, the
+        // validation of the ID, and the allocation of the impl data.
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const auto* node = doc.first_node()->first_node(); node != nullptr; node = node->next_sibling())
+            {
+                IATLTriggerImplData* const triggerData = _system->NewAudioTriggerImplData(node);
+
+                state.PauseTiming();
+                _system->DeleteAudioTriggerImplData(triggerData);
+                state.ResumeTiming();
+            }
+        }
+
+        _system->LoadControlCache();
+        DeleteControlCacheFolder(cacheFolder);
+        SetCallCounters(state);
+    }
+
+    //! Measures the initialization cost of the control cache: every cache file of the folder is read and their entries
+    //! are sorted into one table, whether or not their connections are parsed later.
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, LoadControlCache)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        const EventHandle event = Engine::GetInstance()->GetEventHandle(kBenchmarkEventName);
+        if (event == nullptr)
+        {
+            state.SkipWithError("The benchmark event is not in the loaded banks.");
+            return;
+        }
+
+        char cacheFolder[AZ_MAX_PATH_LEN] = { 0 };
+        if (!ResolveControlCacheFolder(cacheFolder))
+        {
+            state.SkipWithError("The benchmark control cache path could not be resolved.");
+            return;
+        }
+
+        size_t cacheBytes = 0;
+
+        for (size_t i = 0; i < kControlCacheFileCount; ++i)
+        {
+            AZ::rapidxml::xml_document<char> doc;
+            BuildEventConnections(event->GetId(), doc, i * _objects.size());
+
+            AZStd::vector<AZ::u8> cacheData;
+            AmplitudeControlCache::Build(doc.first_node(), cacheData);
+
+            if (!WriteControlCacheFile(cacheFolder, i, cacheData))
+            {
+                DeleteControlCacheFolder(cacheFolder);
+                state.SkipWithError("The benchmark control cache could not be written.");
+                return;
+            }
+
+            cacheBytes += cacheData.size();
+        }
+
+        size_t entryCount = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AmplitudeControlCache cache;
+            benchmark::DoNotOptimize(cache.LoadFolder(cacheFolder));
+            entryCount = cache.GetEntryCount();
+        }
+
+        DeleteControlCacheFolder(cacheFolder);
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kControlCacheFileCount));
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(cacheBytes));
+        state.counters["entries"] = static_cast<double>(entryCount);
+    }
+
+    BENCHMARK_DEFINE_F(AmplitudeAudioSystemBenchmark, RegisterInMemoryFile)(benchmark::State& state)
+    {
+        if (SkipIfNotInitialized(state))
+        {
+            return;
+        }
+
+        SATLAudioFileEntryInfo fileEntry;
+        fileEntry.sFileName = kBenchmarkBankFile;
+        fileEntry.bLocalized = false;
+
+        const AZStd::string filePath = AZStd::string(_system->GetAudioFileLocation(&fileEntry)) + kBenchmarkBankFile;
+        auto fileData = AZ::Utils::ReadFile<AZStd::vector<char>>(filePath);
+        if (!fileData.IsSuccess())
+        {
+            state.SkipWithError("The benchmark soundbank could not be read.");
+            return;
+        }
+
+        AZStd::vector<char> bankData = fileData.TakeValue();
+
+        fileEntry.pFileData = bankData.data();
+        fileEntry.nSize = bankData.size();
+        fileEntry.pImplData = azcreate(
+            SATLAudioFileEntryData_Amplitude, (kAmInvalidObjectId), AudioImplAllocator, "ATLAudioFileEntryData_Amplitude");
+
+        // Banks are registered while the entities are alive, as when a level streams in new content.
+        RegisterObjects();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            _system->RegisterInMemoryFile(&fileEntry);
+
+            state.PauseTiming();
+            _system->UnregisterInMemoryFile(&fileEntry);
+            state.ResumeTiming();
+        }
+
+        UnregisterObjects();
+        _system->DeleteAudioFileEntryData(fileEntry.pImplData);
+
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bankData.size()));
+    }
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, RegisterAudioObject)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, EntityChurn)->Arg(kChurnEntityCount)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, EntityChurnBatched)->Arg(kChurnEntityCount)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, SetPosition)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, SetRtpc)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, SetEnvironment)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, UpdateSendRamps)->Arg(kSendRampVoiceCount)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, ActivateTrigger)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, ParseConnectionsFromXml)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, ParseConnectionsFromCache)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, LoadControlCache)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(AmplitudeAudioSystemBenchmark, RegisterInMemoryFile)
+        ->RangeMultiplier(8)
+        ->Range(kMinEntityCount, kMaxEntityCount)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Audio::Benchmarks
+
+#endif // HAVE_BENCHMARK
@@ -15,12 +15,46 @@
 set(FILES
     Include/SparkyStudios/Audio/Amplitude/AmplitudeAudioBus.h
 
+    Source/Engine/AmplitudeAudioInputSource.cpp
+    Source/Engine/AmplitudeAudioInputSource.h
+    Source/Engine/AmplitudeAudioStats.cpp
+    Source/Engine/AmplitudeAudioStats.h
     Source/Engine/AmplitudeAudioSystem.cpp
     Source/Engine/AmplitudeAudioSystem.h
+    Source/Engine/AmplitudeControlCache.cpp
+    Source/Engine/AmplitudeControlCache.h
+    Source/Engine/AmplitudeDebugSnapshot.cpp
+    Source/Engine/AmplitudeDebugSnapshot.h
+    Source/Engine/AmplitudeEnvironmentRegistry.cpp
+    Source/Engine/AmplitudeEnvironmentRegistry.h
+    Source/Engine/AmplitudeListenerSet.cpp
+    Source/Engine/AmplitudeListenerSet.h
+    Source/Engine/AmplitudeNullDriver.cpp
+    Source/Engine/AmplitudeNullDriver.h
+    Source/Engine/AmplitudeOcclusionService.cpp
+    Source/Engine/AmplitudeOcclusionService.h
+    Source/Engine/AmplitudeOfflineRender.cpp
+    Source/Engine/AmplitudeOfflineRender.h
+    Source/Engine/AmplitudeRequestTrace.cpp
+    Source/Engine/AmplitudeRequestTrace.h
+    Source/Engine/AmplitudeSendRamps.cpp
+    Source/Engine/AmplitudeSendRamps.h
+    Source/Engine/AmplitudeSpatialGrid.cpp
+    Source/Engine/AmplitudeSpatialGrid.h
+    Source/Engine/AmplitudeTelemetryRecorder.cpp
+    Source/Engine/AmplitudeTelemetryRecorder.h
+    Source/Engine/AmplitudeTriggerThrottle.cpp
+    Source/Engine/AmplitudeTriggerThrottle.h
+    Source/Engine/AmplitudeUpdateLod.cpp
+    Source/Engine/AmplitudeUpdateLod.h
+    Source/Engine/AmplitudeVoiceLimiter.cpp
+    Source/Engine/AmplitudeVoiceLimiter.h
     Source/Engine/ATLEntities_amplitude.h
     Source/Engine/Common.h
 
     Source/AmplitudeAudioModuleInterface.h
     Source/AmplitudeAudioSystemComponent.cpp
     Source/AmplitudeAudioSystemComponent.h
+    Source/AmplitudeDebugOverlay.cpp
+    Source/AmplitudeDebugOverlay.h
 )
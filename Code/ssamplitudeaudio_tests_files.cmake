@@ -13,5 +13,7 @@
 # limitations under the License.
 
 set(FILES
+    Tests/AmplitudeAudioInputSourceTests.cpp
+    Tests/AmplitudeAudioSystemBenchmarks.cpp
     Tests/SSAmplitudeAudioTest.cpp
 )
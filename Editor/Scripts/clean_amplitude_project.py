@@ -32,12 +32,13 @@ def main(argv):
     """
 
     projectPath = common.get_o3de_project_path()
+    amplitudeProjectPath = os.path.join(projectPath, "sounds", "amplitude_project")
 
     try:
         common.clean_flatbuffer_binaries(
-            common.get_conversion_data(os.path.join(
-                projectPath, "sounds", "amplitude_project"))
+            common.get_conversion_data(amplitudeProjectPath)
         )
+        common.clean_runtime_settings(amplitudeProjectPath)
         print("Amplitude binary assets cleaned successfully.")
     except common.BuildError as error:
         common.handle_build_error(error)
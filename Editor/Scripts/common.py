@@ -61,6 +61,9 @@ EFFECTS_DIR_NAME = 'effects'
 # Directory where unprocessed environment flatbuffer data can be found.
 ENVIRONMENTS_DIR_NAME = 'environments'
 
+# Name of the gem runtime settings file. It is not an Amplitude asset, and is copied as is.
+RUNTIME_SETTINGS_FILE_NAME = 'runtime_settings.json'
+
 
 class FlatbuffersConversionData(object):
     """Holds data needed to convert a set of json files to flatbuffer binaries.
@@ -176,6 +179,39 @@ def generate_flatbuffer_binaries(flatc, conversion_data):
                     flatc, json, schema, target_file_dir)
 
 
+def copy_runtime_settings(projectPath):
+    """Copy the gem runtime settings file from the project to the assets directory.
+
+    Args:
+      projectPath: Path to the Amplitude project directory.
+    """
+    source = os.path.join(projectPath, RUNTIME_SETTINGS_FILE_NAME)
+    if not os.path.isfile(source):
+        return
+    target = runtime_settings_path(projectPath)
+    target_file_dir = os.path.dirname(target)
+    if not os.path.exists(target_file_dir):
+        os.makedirs(target_file_dir)
+    if needs_rebuild(source, target):
+        shutil.copy2(source, target)
+
+
+def clean_runtime_settings(projectPath):
+    """Delete the copied gem runtime settings file.
+
+    Args:
+      projectPath: Path to the Amplitude project directory.
+    """
+    path = runtime_settings_path(projectPath)
+    if os.path.isfile(path):
+        os.remove(path)
+
+
+def runtime_settings_path(projectPath):
+    """Take the path to the Amplitude project and return the path of the copied runtime settings file."""
+    return os.path.join(projectPath, RUNTIME_SETTINGS_FILE_NAME).replace("amplitude_project", 'amplitude_assets')
+
+
 def find_in_paths(name, paths):
     """Searches for a file with named `name` in the given paths and returns it."""
     for path in paths:
@@ -33,13 +33,14 @@ def main(argv):
     """
 
     projectPath = common.get_o3de_project_path()
+    amplitudeProjectPath = os.path.join(projectPath, "sounds", "amplitude_project")
 
     try:
         common.generate_flatbuffer_binaries(
             common.FLATC,
-            common.get_conversion_data(os.path.join(
-                projectPath, "sounds", "amplitude_project"))
+            common.get_conversion_data(amplitudeProjectPath)
         )
+        common.copy_runtime_settings(amplitudeProjectPath)
         print("Amplitude binary assets compiled successfully.")
     except common.BuildError as error:
         common.handle_build_error(error)